@@ -0,0 +1,52 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Bump-Allokator fuer Solver-Zwischenspeicher
+ *
+ * ************************/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <vector>
+
+// Resettable bump allocator for the per-iteration scratch of the solver
+// cores (distance arrays, predecessor arrays, queues). One buffer is
+// sized up front, every allocation is a pointer bump, and reset()
+// releases everything at once — so repeated small solves stop paying
+// for heap churn between augmentations and cancellations.
+//
+// ensure() may only grow the buffer while the arena is empty, because
+// growing would move every pointer already handed out. Callers reserve
+// the per-iteration worst case before their loop and reset() at the top
+// of each iteration.
+struct arena {
+    std::vector<unsigned char> buf;
+    size_t used;
+
+    arena() : used(0) {}
+
+    // Grow the buffer to at least bytes; only allowed while empty
+    void ensure(size_t bytes){
+        if (used == 0 && buf.size() < bytes) buf.resize(bytes);
+    }
+
+    // Release all allocations at once
+    void reset(){ used = 0; }
+
+    // Allocate count objects of T, aligned, uninitialized
+    template<class T>
+    T* alloc(size_t count){
+        size_t align = alignof(T);
+        size_t start = (used + align - 1) & ~(align - 1);
+        size_t bytes = count * sizeof(T);
+        if (start + bytes > buf.size()) return NULL;   // ensure() was too small
+        used = start + bytes;
+        return (T*)(buf.data() + start);
+    }
+};
+
+#endif
@@ -0,0 +1,291 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Negative-Zyklen-Suche im Restgraphen
+ *
+ * ************************/
+
+#include "Cycle_Detect.h"
+#include "Shortest_Path.h"
+#include "Mcf_Stats.h"
+
+#include <algorithm>
+#include <deque>
+#include <thread>
+
+// Full restarts on graphs with at least this many arcs relax in
+// parallel; below it the thread overhead outweighs the passes
+#ifndef CYCLE_PAR_MIN_ARCS
+#define CYCLE_PAR_MIN_ARCS 50000
+#endif
+
+// Walk the predecessor graph and look for a cycle. Every node follows
+// its pred_arc chain; chains are stamped per start node, so each node
+// is visited only a constant number of times. Returns a node on a
+// cycle, or -1.
+static int pred_graph_cycle(const flat_graph& fg, const int* pred_arc,
+                            int* stamp){
+    for(int v = 0; v < fg.n; v++){
+        if (stamp[v] != 0) continue;
+        // Follow the chain, marking nodes with the current start v+1
+        int x = v;
+        while (x != -1 && stamp[x] == 0){
+            stamp[x] = v+1;
+            x = (pred_arc[x] != -1) ? fg.head[fg.rev[pred_arc[x]]] : -1;
+        }
+        // Re-entering a node stamped in this walk means we closed a cycle
+        if (x != -1 && stamp[x] == v+1) return x;
+    }
+    return -1;
+}
+
+// Collect the arcs of the cycle through z, in forward order
+static void extract_cycle(const flat_graph& fg, const int* pred_arc,
+                          int z, std::vector<int>& cycle_arcs){
+    int x = z;
+    do {
+        int a = pred_arc[x];
+        cycle_arcs.push_back(a);
+        x = fg.head[fg.rev[a]];
+    } while (x != z);
+    std::reverse(cycle_arcs.begin(),cycle_arcs.end());
+}
+
+// One improvement found during a parallel pass: arc a lowers dist at
+// its head to d (computed against the previous pass's distances)
+struct relax_candidate {
+    int v;
+    int d;
+    int a;
+};
+
+// Synchronous Bellman-Ford for full restarts on large graphs. Each pass
+// relaxes disjoint CSR tail ranges across threads; threads only read
+// the distances of the previous pass and collect their improvements
+// locally, so there are no shared writes. The per-thread sets are
+// merged on the calling thread between passes, and the predecessor
+// graph is scanned for a cycle after every pass — once no merge
+// improves anything, the distances have settled.
+static bool find_negative_cycle_parallel(const flat_graph& fg,
+                                         std::vector<int>& cycle_arcs,
+                                         int* dist, int* pred_arc, int* stamp,
+                                         int num_threads){
+    std::vector<std::vector<relax_candidate> > found(num_threads);
+    std::vector<std::thread> workers(num_threads);
+
+    for(;;){
+        for(int t = 0; t < num_threads; t++){
+            int lo = (int)((long long)fg.n * t / num_threads);
+            int hi = (int)((long long)fg.n * (t+1) / num_threads);
+            workers[t] = std::thread([&fg,dist,lo,hi](std::vector<relax_candidate>& out){
+                out.clear();
+                for(int u = lo; u < hi; u++){
+                    int du = dist[u];
+                    for(int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+                        if (fg.res[a] <= 0) continue;
+                        int w = fg.head[a];
+                        if (du + fg.cost[a] < dist[w]){
+                            relax_candidate c = { w, du + fg.cost[a], a };
+                            out.push_back(c);
+                        }
+                    }
+                }
+            },std::ref(found[t]));
+        }
+        for(int t = 0; t < num_threads; t++) workers[t].join();
+
+        bool improved = false;
+        for(int t = 0; t < num_threads; t++){
+            for(const relax_candidate& c : found[t]){
+                // Re-check against the merged state: another thread's
+                // candidate may already be better
+                if (c.d < dist[c.v]){
+                    dist[c.v] = c.d;
+                    pred_arc[c.v] = c.a;
+                    improved = true;
+                    MCF_STAT_INC(relaxations);
+                }
+            }
+        }
+        if (!improved) break;
+
+        for(int v = 0; v < fg.n; v++) stamp[v] = 0;
+        int z = pred_graph_cycle(fg,pred_arc,stamp);
+        if (z != -1){
+            extract_cycle(fg,pred_arc,z,cycle_arcs);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool find_negative_cycle(const flat_graph& fg, const std::vector<int>& seeds,
+                         std::vector<int>& cycle_arcs, arena& scratch){
+    cycle_arcs.clear();
+
+    // All per-search arrays are bump allocations; one reset releases the
+    // previous search
+    scratch.reset();
+    scratch.ensure(3*(size_t)fg.n*sizeof(int) + (size_t)fg.n);
+    int* dist      = scratch.alloc<int>(fg.n);
+    int* pred_arc  = scratch.alloc<int>(fg.n);
+    int* stamp     = scratch.alloc<int>(fg.n);
+    char* in_queue = scratch.alloc<char>(fg.n);
+    for(int v = 0; v < fg.n; v++){
+        dist[v] = 0;
+        pred_arc[v] = -1;
+        in_queue[v] = 0;
+    }
+    // Seeded searches are small and targeted; only a full restart on a
+    // big graph is worth spinning up threads for
+    if (seeds.empty() && fg.m >= CYCLE_PAR_MIN_ARCS){
+        int num_threads = (int)std::thread::hardware_concurrency();
+        if (num_threads > 1)
+            return find_negative_cycle_parallel(fg,cycle_arcs,dist,pred_arc,stamp,num_threads);
+    }
+
+    std::deque<int> q;
+
+    // Distance 0 everywhere makes every node a virtual source, so any
+    // negative cycle is found no matter where it lies; the seed set only
+    // controls where the queue starts working
+    if (seeds.empty()){
+        for(int v = 0; v < fg.n; v++){ q.push_back(v); in_queue[v] = 1; }
+    }
+    else {
+        for(int v : seeds){
+            if (!in_queue[v]){ q.push_back(v); in_queue[v] = 1; }
+        }
+    }
+
+    // Amortized early termination: instead of waiting for n full rounds,
+    // scan the predecessor graph for a cycle every n relaxations
+    int relaxations = 0;
+
+    while (!q.empty()){
+        int u = q.front();
+        q.pop_front();
+        in_queue[u] = 0;
+        MCF_STAT_INC(nodes_scanned);
+
+        for(int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+            if (fg.res[a] <= 0) continue;
+            int w = fg.head[a];
+            if (dist[u] + fg.cost[a] < dist[w]){
+                dist[w] = dist[u] + fg.cost[a];
+                pred_arc[w] = a;
+                MCF_STAT_INC(relaxations);
+
+                if (++relaxations >= fg.n){
+                    relaxations = 0;
+                    for(int v = 0; v < fg.n; v++) stamp[v] = 0;
+                    int z = pred_graph_cycle(fg,pred_arc,stamp);
+                    if (z != -1){
+                        extract_cycle(fg,pred_arc,z,cycle_arcs);
+                        return true;
+                    }
+                }
+
+                if (!in_queue[w]){
+                    q.push_back(w);
+                    in_queue[w] = 1;
+                }
+            }
+        }
+    }
+
+    // The queue ran dry: distances settled, so no negative cycle is
+    // reachable from the seeds
+    if (!seeds.empty()) return false;
+
+    // Full-seed run that settled has no negative cycle at all, but a
+    // final predecessor scan is still needed in case one formed right
+    // before the queue emptied
+    for(int v = 0; v < fg.n; v++) stamp[v] = 0;
+    int z = pred_graph_cycle(fg,pred_arc,stamp);
+    if (z != -1){
+        extract_cycle(fg,pred_arc,z,cycle_arcs);
+        return true;
+    }
+    return false;
+}
+
+bool find_min_mean_cycle(const flat_graph& fg, std::vector<int>& cycle_arcs){
+    cycle_arcs.clear();
+    int n = fg.n;
+    if (n == 0) return false;
+
+    const long long LINF = 0x3fffffffffffffffLL;
+
+    // d[k*n+v]: cheapest walk of exactly k arcs ending in v, starting
+    // anywhere (level 0 is 0 everywhere, the usual virtual source)
+    std::vector<long long> d((size_t)(n+1)*n,LINF);
+    std::vector<int> pred((size_t)(n+1)*n,-1);
+    for(int v = 0; v < n; v++) d[v] = 0;
+
+    for(int k = 1; k <= n; k++){
+        size_t row = (size_t)k*n;
+        size_t prow = row - n;
+        for(int u = 0; u < n; u++){
+            if (d[prow+u] == LINF) continue;
+            for(int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+                if (fg.res[a] <= 0) continue;
+                int w = fg.head[a];
+                if (d[prow+u] + fg.cost[a] < d[row+w]){
+                    d[row+w] = d[prow+u] + fg.cost[a];
+                    pred[row+w] = a;
+                }
+            }
+        }
+    }
+
+    // mu* = min_v max_k (d_n(v)-d_k(v))/(n-k), compared as fractions
+    size_t last = (size_t)n*n;
+    int best_v = -1;
+    long long best_num = 0, best_den = 1;
+    for(int v = 0; v < n; v++){
+        if (d[last+v] == LINF) continue;
+        long long num = 0, den = 1;
+        bool have = false;
+        for(int k = 0; k < n; k++){
+            if (d[(size_t)k*n+v] == LINF) continue;
+            long long cnum = d[last+v] - d[(size_t)k*n+v];
+            long long cden = n - k;
+            if (!have || cnum*den > num*cden){ num = cnum; den = cden; have = true; }
+        }
+        if (!have) continue;
+        if (best_v == -1 || num*best_den < best_num*den){
+            best_num = num; best_den = den; best_v = v;
+        }
+    }
+
+    // No length-n walk at all means the residual graph is acyclic; a
+    // non-negative minimum mean means the flow is already optimal
+    if (best_v == -1 || best_num >= 0) return false;
+
+    // Walk the predecessor levels down from best_v; n+1 nodes must
+    // repeat, and the enclosed piece is the cycle
+    std::vector<int> walk_arcs(n);
+    std::vector<int> walk_nodes(n+1);
+    int x = best_v;
+    walk_nodes[n] = x;
+    for(int k = n; k >= 1; k--){
+        int a = pred[(size_t)k*n+x];
+        walk_arcs[k-1] = a;
+        x = fg.head[fg.rev[a]];
+        walk_nodes[k-1] = x;
+    }
+
+    std::vector<int> seen(n,-1);
+    for(int i = 0; i <= n; i++){
+        int v = walk_nodes[i];
+        if (seen[v] != -1){
+            for(int j = seen[v]; j < i; j++) cycle_arcs.push_back(walk_arcs[j]);
+            return true;
+        }
+        seen[v] = i;
+    }
+    return false;   // unreachable
+}
@@ -0,0 +1,42 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Negative-Zyklen-Suche im Restgraphen
+ *
+ * ************************/
+
+#ifndef CYCLE_DETECT_H
+#define CYCLE_DETECT_H
+
+#include "Arena.h"
+#include "Flat_Graph.h"
+
+#include <vector>
+
+// Negative cycle detector for the cycle canceling core, built for
+// throughput: SPFA-style queue instead of full Bellman-Ford rounds,
+// early exit as soon as the first cycle is found, and restartable from
+// a seed set so each cancellation can resume the search around the
+// region it just changed instead of scanning the whole graph again.
+
+// Search the residual graph of fg for a negative cycle, starting from
+// the given seed nodes (empty means all nodes). On success the arcs of
+// one negative cycle are written to cycle_arcs, in order, and true is
+// returned. On failure cycle_arcs is left empty.
+// Distance, predecessor and marker arrays come out of the caller's
+// arena (reset on entry), so a cancellation loop allocates nothing per
+// search; scratch.ensure() is handled inside.
+bool find_negative_cycle(const flat_graph& fg, const std::vector<int>& seeds,
+                         std::vector<int>& cycle_arcs, arena& scratch);
+
+// Minimum mean cycle via Karp's algorithm: dynamic program over walk
+// lengths 0..n, then mu* = min_v max_k (d_n(v)-d_k(v))/(n-k) and the
+// cycle is read off the argmin walk. Returns false when the minimum
+// mean is non-negative, i.e. the flow is optimal. Canceling these
+// cycles gives the strongly polynomial bound; note the O(n^2) tables,
+// which is inherent to Karp and fine for cancellation-bound instances.
+bool find_min_mean_cycle(const flat_graph& fg, std::vector<int>& cycle_arcs);
+
+#endif
@@ -0,0 +1,110 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      4-aerer Array-Heap fuer die Dijkstra-Suche
+ *
+ * ************************/
+
+#ifndef D_HEAP_H
+#define D_HEAP_H
+
+#include <vector>
+
+// Flat 4-ary min-heap over node indices 0..n-1 with decrease-key via a
+// position index. Four children per node keep the tree shallow and the
+// child scan inside one cache line, which is where Dijkstra spends a
+// large share of its time on road-network-like graphs. The arrays are
+// sized once per solve (init) and reused across augmentations (clear is
+// O(heap size), not O(n)).
+struct d_heap {
+    static const int D = 4;
+
+    std::vector<int> heap;   // heap order -> node
+    std::vector<int> pos;    // node -> heap index, -1 if not contained
+    std::vector<int> key;    // node -> current key
+
+    int count;
+
+    d_heap() : count(0) {}
+
+    // Size the arrays for n nodes; call once per solve
+    void init(int n){
+        heap.resize(n);
+        pos.assign(n,-1);
+        key.resize(n);
+        count = 0;
+    }
+
+    // Remove all contained nodes, touching only the occupied slots
+    void clear(){
+        for(int i = 0; i < count; i++) pos[heap[i]] = -1;
+        count = 0;
+    }
+
+    bool empty() const { return count == 0; }
+
+    void sift_up(int i){
+        int v = heap[i];
+        int k = key[v];
+        while (i > 0){
+            int parent = (i-1)/D;
+            if (key[heap[parent]] <= k) break;
+            heap[i] = heap[parent];
+            pos[heap[i]] = i;
+            i = parent;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+    void sift_down(int i){
+        int v = heap[i];
+        int k = key[v];
+        while (true){
+            int first = D*i + 1;
+            if (first >= count) break;
+            int last = first + D;
+            if (last > count) last = count;
+            int best = first;
+            for(int c = first+1; c < last; c++){
+                if (key[heap[c]] < key[heap[best]]) best = c;
+            }
+            if (key[heap[best]] >= k) break;
+            heap[i] = heap[best];
+            pos[heap[i]] = i;
+            i = best;
+        }
+        heap[i] = v;
+        pos[v] = i;
+    }
+
+    // Insert v with key k, or decrease its key if already contained
+    void insert_or_decrease(int v, int k){
+        key[v] = k;
+        if (pos[v] == -1){
+            heap[count] = v;
+            pos[v] = count;
+            count++;
+            sift_up(count-1);
+        }
+        else {
+            sift_up(pos[v]);
+        }
+    }
+
+    int extract_min(){
+        int v = heap[0];
+        pos[v] = -1;
+        count--;
+        if (count > 0){
+            heap[0] = heap[count];
+            pos[heap[0]] = 0;
+            sift_down(0);
+        }
+        return v;
+    }
+};
+
+#endif
@@ -0,0 +1,126 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      DIMACS-Leser fuer .min Instanzen
+ *
+ * ************************/
+
+#include "Dimacs.h"
+
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Streaming integer parse straight off the mapped buffer
+static long parse_int(const char*& p, const char* end){
+    while (p < end && (*p == ' ' || *p == '\t')) p++;
+    bool neg = (p < end && *p == '-');
+    if (neg) p++;
+    long value = 0;
+    while (p < end && *p >= '0' && *p <= '9') value = value*10 + (*p++ - '0');
+    return neg ? -value : value;
+}
+
+static void skip_line(const char*& p, const char* end){
+    while (p < end && *p != '\n') p++;
+    if (p < end) p++;
+}
+
+bool load_dimacs(const char* path, raw_instance& inst){
+    int fd = open(path,O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd,&st) < 0 || st.st_size == 0){
+        close(fd);
+        return false;
+    }
+
+    const char* data = (const char*) mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    const char* p = data;
+    const char* end = data + st.st_size;
+
+    inst.n = 0;
+    inst.src.clear(); inst.dst.clear();
+    inst.cost.clear(); inst.cap.clear();
+    inst.balance.clear();
+
+    long m_declared = 0;
+    bool ok = false;
+
+    while (p < end){
+        char tag = *p++;
+        // A blank line's newline is the tag itself; skipping a line on
+        // top of that would swallow the following record
+        if (tag == '\n' || tag == '\r') continue;
+        switch (tag){
+        case 'p':
+            // "p min <nodes> <arcs>"
+            while (p < end && *p != ' ') p++;      // problem designator
+            if (end - p < 4){ ok = false; break; } // truncated header
+            p += 4;
+            inst.n = (int) parse_int(p,end);
+            m_declared = parse_int(p,end);
+            inst.balance.assign(inst.n,0);
+            inst.src.reserve(m_declared);
+            inst.dst.reserve(m_declared);
+            inst.cost.reserve(m_declared);
+            inst.cap.reserve(m_declared);
+            ok = (inst.n > 0);
+            break;
+        case 'n': {
+            // "n <id> <flow>", ids are 1-based
+            long v = parse_int(p,end);
+            long b = parse_int(p,end);
+            if (v < 1 || v > inst.n){ ok = false; break; }
+            inst.balance[v-1] = (int) b;
+            break;
+        }
+        case 'a': {
+            // "a <src> <dst> <low> <cap> <cost>"
+            long u = parse_int(p,end);
+            long w = parse_int(p,end);
+            parse_int(p,end);                      // lower bound, assumed 0
+            long cap = parse_int(p,end);
+            long cost = parse_int(p,end);
+            if (u < 1 || u > inst.n || w < 1 || w > inst.n){ ok = false; break; }
+            inst.src.push_back((int)(u-1));
+            inst.dst.push_back((int)(w-1));
+            inst.cap.push_back((int) cap);
+            inst.cost.push_back((int) cost);
+            break;
+        }
+        default:
+            break;                                 // comments and blanks
+        }
+        if (!ok && tag != 'c' && tag != 'p') break;
+        skip_line(p,end);
+    }
+
+    munmap((void*)data,st.st_size);
+    return ok && (long)inst.src.size() == m_declared;
+}
+
+bool load_dimacs(const char* path, GRAPH<int,int>& G,
+                 edge_map<int>& Gcost, edge_map<int>& Gcap){
+    raw_instance inst;
+    if (!load_dimacs(path,inst)) return false;
+
+    G.clear();
+    std::vector<node> node_of(inst.n);
+    for(int v = 0; v < inst.n; v++) node_of[v] = G.new_node(inst.balance[v]);
+    for(size_t i = 0; i < inst.src.size(); i++){
+        edge e = G.new_edge(node_of[inst.src[i]],node_of[inst.dst[i]]);
+        Gcost[e] = inst.cost[i];
+        Gcap[e]  = inst.cap[i];
+    }
+    return true;
+}
@@ -0,0 +1,33 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      DIMACS-Leser fuer .min Instanzen
+ *
+ * ************************/
+
+#ifndef DIMACS_H
+#define DIMACS_H
+
+#include "Instance_Gen.h"
+
+#include <LEDA/graph/graph.h>
+
+using namespace leda;
+
+// Reader for the DIMACS min-cost-flow format (`p min`, `n` supply and
+// `a` arc lines). The file is mapped read-only and parsed by walking
+// the buffer directly — no getline, no per-line string allocation — so
+// loading large instances stays I/O-bound. Lower bounds on arcs are
+// expected to be 0 and are skipped.
+
+// Parse into raw edge arrays (node ids become 0-based), ready for
+// flat_graph::build_raw. Returns false on open or format errors.
+bool load_dimacs(const char* path, raw_instance& inst);
+
+// Convenience overload: parse and bulk-insert into G with its maps.
+bool load_dimacs(const char* path, GRAPH<int,int>& G,
+                 edge_map<int>& Gcost, edge_map<int>& Gcap);
+
+#endif
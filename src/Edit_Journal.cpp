@@ -0,0 +1,81 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Aenderungsjournal fuer Kosten- und Kapazitaets-Edits
+ *
+ * ************************/
+
+#include "Edit_Journal.h"
+
+#include <cstdio>
+
+// Variables
+const int JOURNAL_MAGIC   = 0x4A46434D;   // "MCFJ", little endian
+const int JOURNAL_VERSION = 1;
+
+bool edit_journal::save(const char* path) const {
+    FILE* f = fopen(path,"wb");
+    if (f == NULL) return false;
+
+    long long count = (head < (long long)RING) ? head : (long long)RING;
+    int header[4] = { JOURNAL_MAGIC, JOURNAL_VERSION, (int)count, 0 };
+    bool ok = fwrite(header,sizeof(int),4,f) == 4;
+
+    // Oldest surviving record first, so replay order equals edit order
+    for (long long i = head - count; ok && i < head; i++)
+        ok = fwrite(&ring[i % RING],sizeof(record),1,f) == 1;
+    fclose(f);
+    return ok;
+}
+
+bool edit_journal::load(const char* path){
+    FILE* f = fopen(path,"rb");
+    if (f == NULL) return false;
+
+    int header[4];
+    if (fread(header,sizeof(int),4,f) != 4 ||
+        header[0] != JOURNAL_MAGIC || header[1] != JOURNAL_VERSION ||
+        header[2] < 0 || header[2] > RING){
+        fclose(f);
+        return false;
+    }
+
+    head = 0;
+    undo_floor = 0;
+    for (int i = 0; i < header[2]; i++){
+        record r;
+        if (fread(&r,sizeof(record),1,f) != 1){ fclose(f); return false; }
+        append(r.edge_index,r.field,r.old_value,r.new_value);
+    }
+    fclose(f);
+    return true;
+}
+
+void edit_journal::apply(raw_instance& inst) const {
+    long long count = (head < (long long)RING) ? head : (long long)RING;
+    for (long long i = head - count; i < head; i++){
+        const record& r = ring[i % RING];
+        if (r.edge_index < 0 || (size_t)r.edge_index >= inst.cost.size()) continue;
+        if (r.field == FIELD_COST) inst.cost[r.edge_index] = r.new_value;
+        else                       inst.cap[r.edge_index]  = r.new_value;
+    }
+}
+
+void edit_journal::apply(flat_graph& fg) const {
+    long long count = (head < (long long)RING) ? head : (long long)RING;
+    for (long long i = head - count; i < head; i++){
+        const record& r = ring[i % RING];
+        if (r.edge_index < 0 || (size_t)r.edge_index >= fg.arc_of.size()) continue;
+        int a = fg.arc_of[r.edge_index];
+        if (r.field == FIELD_COST){
+            fg.cost[a] = r.new_value;
+            fg.cost[fg.rev[a]] = -r.new_value;
+        }
+        else {
+            // Pre-solve snapshot: the forward residual is the capacity
+            fg.res[a] = r.new_value;
+        }
+    }
+}
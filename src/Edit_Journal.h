@@ -0,0 +1,79 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Aenderungsjournal fuer Kosten- und Kapazitaets-Edits
+ *
+ * ************************/
+
+#ifndef EDIT_JOURNAL_H
+#define EDIT_JOURNAL_H
+
+#include "Flat_Graph.h"
+#include "Instance_Gen.h"
+
+// Append-only history of slider edits. Every change to a cost or
+// capacity lands as one fixed-size record in a preallocated ring, so
+// recording costs one store on the handler path. The newest records
+// back interactive undo; a saved journal replays an entire edit session
+// against the headless solver without any GraphWin involved.
+//
+// Edges are identified by their LEDA index(e). That matches the array
+// position of snapshot and DIMACS instances as long as no edges were
+// deleted during the session.
+struct edit_journal {
+    enum { FIELD_COST = 0, FIELD_CAP = 1 };
+
+    struct record {
+        int edge_index;
+        int field;
+        int old_value;
+        int new_value;
+    };
+
+    static const int RING = 65536;
+    std::vector<record> ring;
+    long long head;           // total records ever appended
+    long long undo_floor;     // oldest record not yet overwritten
+
+    edit_journal() : ring(RING), head(0), undo_floor(0) {}
+
+    // O(1); once the ring wraps the oldest records fall out of the
+    // undo window but the session stays replayable up to RING edits.
+    // The floor tracks how far undo may reach back: slots past it hold
+    // newer records again, not the history they once did.
+    void append(int edge_index, int field, int old_value, int new_value){
+        record& r = ring[head % RING];
+        r.edge_index = edge_index;
+        r.field = field;
+        r.old_value = old_value;
+        r.new_value = new_value;
+        head++;
+        if (head - undo_floor > RING) undo_floor = head - RING;
+    }
+
+    bool empty() const { return head == 0; }
+
+    // Pop the newest record for interactive undo; the caller restores
+    // the maps from r.old_value. Fails once undo reaches the floor:
+    // records the ring overwrote cannot be taken back.
+    bool undo_last(record& r){
+        if (head == undo_floor) return false;
+        head--;
+        r = ring[head % RING];
+        return true;
+    }
+
+    // Persistence for batch replay
+    bool save(const char* path) const;
+    bool load(const char* path);
+
+    // Apply the journaled edits in order. The raw variant rewrites the
+    // instance arrays before the flat build; the flat variant patches a
+    // freshly built (unsolved) snapshot through arc_of.
+    void apply(raw_instance& inst) const;
+    void apply(flat_graph& fg) const;
+};
+
+#endif
@@ -0,0 +1,103 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Flache CSR-Graphdarstellung fuer die Solver-Kerne
+ *
+ * ************************/
+
+#include "Flat_Graph.h"
+
+void flat_graph::build(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                       const edge_map<int>& Gcap){
+    n = G.number_of_nodes();
+    m = 2 * G.number_of_edges();
+
+    node v;
+    edge e;
+
+    // Number the nodes once; everything below works on flat indices
+    node_array<int> num(G);
+    node_of.assign(n,nil);
+    balance.assign(n,0);
+    int i = 0;
+    forall_nodes(v,G){
+        num[v] = i;
+        node_of[i] = v;
+        balance[i] = G.node_data()[v];
+        i++;
+    }
+
+    // Counting pass: each edge contributes a forward arc at its source
+    // and a backward arc at its target
+    first_out.assign(n+1,0);
+    forall_edges(e,G){
+        first_out[num[G.source(e)]+1]++;
+        first_out[num[G.target(e)]+1]++;
+    }
+    for(int u = 0; u < n; u++) first_out[u+1] += first_out[u];
+
+    // Filling pass
+    head.assign(m,0);
+    cost.assign(m,0);
+    res.assign(m,0);
+    rev.assign(m,0);
+    forward.assign(m,0);
+    edge_of.assign(m,nil);
+    arc_of.assign(G.max_edge_index()+1,-1);
+
+    std::vector<int> next(first_out.begin(), first_out.end()-1);
+    forall_edges(e,G){
+        int u = num[G.source(e)];
+        int w = num[G.target(e)];
+        int a = next[u]++;      // forward arc
+        int b = next[w]++;      // backward arc
+        head[a] = w;  cost[a] =  Gcost[e];  res[a] = Gcap[e];  rev[a] = b;
+        head[b] = u;  cost[b] = -Gcost[e];  res[b] = 0;        rev[b] = a;
+        forward[a] = 1;
+        edge_of[a] = e;
+        arc_of[index(e)] = a;
+    }
+}
+
+void flat_graph::build_raw(int n_nodes, const std::vector<int>& src, const std::vector<int>& dst,
+                           const std::vector<int>& ecost, const std::vector<int>& ecap,
+                           const std::vector<int>& nbalance){
+    n = n_nodes;
+    m = 2 * (int)src.size();
+    balance = nbalance;
+
+    node_of.clear();
+    edge_of.assign(m,nil);
+    arc_of.clear();
+
+    first_out.assign(n+1,0);
+    for(size_t i = 0; i < src.size(); i++){
+        first_out[src[i]+1]++;
+        first_out[dst[i]+1]++;
+    }
+    for(int u = 0; u < n; u++) first_out[u+1] += first_out[u];
+
+    head.assign(m,0);
+    cost.assign(m,0);
+    res.assign(m,0);
+    rev.assign(m,0);
+    forward.assign(m,0);
+
+    std::vector<int> next(first_out.begin(), first_out.end()-1);
+    for(size_t i = 0; i < src.size(); i++){
+        int a = next[src[i]]++;     // forward arc
+        int b = next[dst[i]]++;     // backward arc
+        head[a] = dst[i];  cost[a] =  ecost[i];  res[a] = ecap[i];  rev[a] = b;
+        head[b] = src[i];  cost[b] = -ecost[i];  res[b] = 0;        rev[b] = a;
+        forward[a] = 1;
+    }
+}
+
+void flat_graph::sync_flow(const edge_map<int>& Gcap, edge_map<int>& Gflow) const {
+    for(int a = 0; a < m; a++){
+        edge e = edge_of[a];
+        if (e != nil) Gflow[e] = Gcap[e] - res[a];
+    }
+}
@@ -0,0 +1,66 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Flache CSR-Graphdarstellung fuer die Solver-Kerne
+ *
+ * ************************/
+
+#ifndef FLAT_GRAPH_H
+#define FLAT_GRAPH_H
+
+#include <LEDA/graph/graph.h>
+#include <vector>
+
+using namespace leda;
+
+// Compressed-sparse-row snapshot of G together with its cost/cap maps.
+// The pointer-based GRAPH is only touched when the snapshot is built and
+// when results are synced back; the solver inner loops run entirely on
+// the contiguous arrays below, which keeps them cache-friendly on large
+// instances.
+//
+// Every LEDA edge becomes a pair of residual arcs: a forward arc with
+// the edge's capacity and cost and a backward arc with capacity 0 and
+// negated cost. rev[a] is the index of the partner arc, so augmenting
+// along arc a is res[a] -= f; res[rev[a]] += f.
+//
+// This IS the residual graph: it is built once per solve and never
+// reconstructed. Pushing flow along a path or cycle only touches the
+// arcs on it, so an iteration costs O(path length) for the update, and
+// res[a] + res[rev[a]] == cap(e) holds for every pair throughout. The
+// flow on an edge is simply res[rev[a]] of its forward arc. Both solver
+// cores (shortest augmenting paths and cycle canceling) run on this
+// representation.
+struct flat_graph {
+    int n;                        // number of nodes
+    int m;                        // number of residual arcs (2 per edge)
+
+    std::vector<int> first_out;   // size n+1, CSR offsets into the arc arrays
+    std::vector<int> head;        // size m, target node of each arc
+    std::vector<int> cost;        // size m, backward arcs carry the negated cost
+    std::vector<int> res;         // size m, residual capacity, updated in place
+    std::vector<int> rev;         // size m, index of the paired reverse arc
+    std::vector<char> forward;    // size m, 1 for the forward arc of each pair
+    std::vector<int> balance;     // size n, supply/demand from node_data
+
+    std::vector<node> node_of;    // flat index -> LEDA node
+    std::vector<edge> edge_of;    // forward arc -> LEDA edge, nil for backward arcs
+    std::vector<int>  arc_of;     // index(e) -> forward arc of that edge
+
+    // Build the snapshot from G. Balances are taken from G.node_data().
+    void build(GRAPH<int,int>& G, const edge_map<int>& Gcost, const edge_map<int>& Gcap);
+
+    // Build directly from edge arrays (src[i] -> dst[i]) without a LEDA
+    // graph, for generated or file-loaded instances. node_of/edge_of
+    // stay empty, so there is nothing to sync back to.
+    void build_raw(int n_nodes, const std::vector<int>& src, const std::vector<int>& dst,
+                   const std::vector<int>& ecost, const std::vector<int>& ecap,
+                   const std::vector<int>& nbalance);
+
+    // Write the flow implied by the residual capacities back into Gflow.
+    void sync_flow(const edge_map<int>& Gcap, edge_map<int>& Gflow) const;
+};
+
+#endif
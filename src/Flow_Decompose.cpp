@@ -0,0 +1,147 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Zerlegung des optimalen Flusses in Pfade und Kreise
+ *
+ * ************************/
+
+#include "Flow_Decompose.h"
+
+// Shared walk state: remaining flow per forward arc, a cursor per node
+// that skips exhausted arcs once and never moves back, and the stack of
+// the current walk with a stamp marking which nodes are on it.
+struct peel_state {
+    const flat_graph* fg;
+    std::vector<int> flow;      // remaining flow per arc, backward arcs 0
+    std::vector<int> cur;       // per-node cursor into the arc range
+    std::vector<int> on_stack;  // node -> position on the walk stack, -1 if off
+    std::vector<int> stack;     // forward arcs of the current walk
+    flow_path path;             // reused emit buffer
+};
+
+// Advance cur[v] to the next forward arc with remaining flow; returns
+// the arc or -1 if v has none left.
+static int next_flow_arc(peel_state& st, int v){
+    const flat_graph& fg = *st.fg;
+    int& c = st.cur[v];
+    while (c < fg.first_out[v+1]){
+        if (fg.forward[c] && st.flow[c] > 0) return c;
+        c++;
+    }
+    return -1;
+}
+
+// Subtract `amount` from the arcs stack[from..end) and emit them as one
+// path or cycle. Arcs that drop to zero stay behind their node's cursor
+// and are skipped on the next visit.
+static int emit_piece(peel_state& st, size_t from, int amount, bool is_cycle,
+                      flow_path_sink sink, void* ctx){
+    const flat_graph& fg = *st.fg;
+    st.path.arcs.clear();
+    st.path.amount = amount;
+    st.path.cost = 0;
+    st.path.is_cycle = is_cycle;
+    for (size_t i = from; i < st.stack.size(); i++){
+        int a = st.stack[i];
+        st.flow[a] -= amount;
+        st.path.cost += fg.cost[a];
+        st.path.arcs.push_back(a);
+    }
+    sink(st.path,ctx);
+    return 1;
+}
+
+// Walk forward-flow arcs from v until the walk closes a cycle or runs
+// out of arcs (at a demand node, by conservation). Cycles are peeled
+// and cut out of the walk as they appear; the final stack is a simple
+// path from v. Returns the number of pieces emitted on the way and
+// leaves the path on st.stack for the caller to peel.
+static int walk_from(peel_state& st, int v, flow_path_sink sink, void* ctx){
+    const flat_graph& fg = *st.fg;
+    int emitted = 0;
+    st.stack.clear();
+    st.on_stack[v] = 0;
+    int u = v;
+    int a;
+    while ((a = next_flow_arc(st,u)) != -1){
+        int w = fg.head[a];
+        st.stack.push_back(a);
+        if (st.on_stack[w] != -1){
+            // Closed a cycle: peel it at its bottleneck and shrink the
+            // walk back to w, then keep walking
+            size_t from = (size_t)st.on_stack[w];
+            int bottleneck = st.flow[st.stack[from]];
+            for (size_t i = from+1; i < st.stack.size(); i++)
+                if (st.flow[st.stack[i]] < bottleneck) bottleneck = st.flow[st.stack[i]];
+            emitted += emit_piece(st,from,bottleneck,true,sink,ctx);
+            for (size_t i = from; i < st.stack.size(); i++)
+                st.on_stack[fg.head[st.stack[i]]] = -1;
+            st.stack.resize(from);
+            st.on_stack[w] = (int)from;
+            u = w;
+        }
+        else {
+            st.on_stack[w] = (int)st.stack.size();
+            u = w;
+        }
+    }
+    return emitted;
+}
+
+static void clear_stack_marks(peel_state& st, int start){
+    const flat_graph& fg = *st.fg;
+    st.on_stack[start] = -1;
+    for (size_t i = 0; i < st.stack.size(); i++)
+        st.on_stack[fg.head[st.stack[i]]] = -1;
+}
+
+int decompose_flow(const flat_graph& fg, flow_path_sink sink, void* ctx){
+    peel_state st;
+    st.fg = &fg;
+    st.flow.assign(fg.m,0);
+    for (int a = 0; a < fg.m; a++)
+        if (fg.forward[a]) st.flow[a] = fg.res[fg.rev[a]];
+    st.cur.assign(fg.n,0);
+    for (int v = 0; v < fg.n; v++) st.cur[v] = fg.first_out[v];
+    st.on_stack.assign(fg.n,-1);
+
+    int emitted = 0;
+
+    // Phase 1: source-to-sink paths. Each supply node is drained by
+    // repeated walks; every walk ends at a node with unmet demand.
+    for (int s = 0; s < fg.n; s++){
+        int supply = fg.balance[s];
+        while (supply > 0){
+            emitted += walk_from(st,s,sink,ctx);
+            if (st.stack.empty()){ clear_stack_marks(st,s); break; }
+            int bottleneck = supply;
+            for (size_t i = 0; i < st.stack.size(); i++)
+                if (st.flow[st.stack[i]] < bottleneck) bottleneck = st.flow[st.stack[i]];
+            emitted += emit_piece(st,0,bottleneck,false,sink,ctx);
+            supply -= bottleneck;
+            clear_stack_marks(st,s);
+        }
+    }
+
+    // Phase 2: leftover circulation. Any arc still carrying flow lies
+    // on a cycle; the walk from its tail peels it.
+    for (int v = 0; v < fg.n; v++){
+        while (next_flow_arc(st,v) != -1){
+            emitted += walk_from(st,v,sink,ctx);
+            if (!st.stack.empty()){
+                // Only reachable if the input flow does not conserve;
+                // peel the dangling walk as a path so an arc always
+                // reaches zero and the loop makes progress
+                int bottleneck = st.flow[st.stack[0]];
+                for (size_t i = 1; i < st.stack.size(); i++)
+                    if (st.flow[st.stack[i]] < bottleneck) bottleneck = st.flow[st.stack[i]];
+                emitted += emit_piece(st,0,bottleneck,false,sink,ctx);
+            }
+            clear_stack_marks(st,v);
+        }
+    }
+
+    return emitted;
+}
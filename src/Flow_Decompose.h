@@ -0,0 +1,38 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Zerlegung des optimalen Flusses in Pfade und Kreise
+ *
+ * ************************/
+
+#ifndef FLOW_DECOMPOSE_H
+#define FLOW_DECOMPOSE_H
+
+#include "Flat_Graph.h"
+
+// One element of the flow decomposition: a source-to-sink path or a
+// cycle, carrying `amount` units. `arcs` holds forward arc indices into
+// the flat_graph in walk order; fg.edge_of maps them back to LEDA edges
+// for graphs built from a GRAPH. cost is per unit of flow.
+struct flow_path {
+    std::vector<int> arcs;
+    int amount;
+    int cost;
+    bool is_cycle;
+};
+
+// Called once per peeled path or cycle, while the decomposition is
+// still running; the flow_path is only valid during the call.
+typedef void (*flow_path_sink)(const flow_path& p, void* ctx);
+
+// Decompose the flow held in fg's residual capacities (flow on an edge
+// is res[rev[a]] of its forward arc) into at most m paths and cycles.
+// Paths are peeled from the supply nodes first, leftover circulation
+// comes out as cycles. fg itself is not modified; the walk uses
+// per-node arc cursors, so the total work is O(n + m + output length).
+// Returns the number of elements emitted.
+int decompose_flow(const flat_graph& fg, flow_path_sink sink, void* ctx);
+
+#endif
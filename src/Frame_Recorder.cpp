@@ -0,0 +1,40 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Frame-Rekorder fuer die Animation eines Loeser-Laufs
+ *
+ * ************************/
+
+#include "Frame_Recorder.h"
+
+void frame_recorder::start(const flat_graph& fg){
+    changes.clear();
+    frame_first.clear();
+    last.clear();
+    frame_first.push_back(0);
+    capture(fg);
+}
+
+void frame_recorder::capture(const flat_graph& fg){
+    for(int a = 0; a < fg.m; a++){
+        if (!fg.forward[a] || fg.edge_of[a] == nil) continue;
+        int idx = index(fg.edge_of[a]);
+        int flow = fg.res[fg.rev[a]];
+        if (idx >= (int)last.size()) last.resize(idx+1,0);
+        if (flow != last[idx] || frame_first.size() == 1){
+            changes.push_back({idx,flow});
+            last[idx] = flow;
+        }
+    }
+    frame_first.push_back((int)changes.size());
+}
+
+void frame_recorder::flow_at(int f, std::vector<int>& out) const {
+    out.assign(last.size(),0);
+    for(int g = 0; g <= f && g < frames(); g++){
+        for(int i = frame_first[g]; i < frame_first[g+1]; i++)
+            out[changes[i].edge_index] = changes[i].flow;
+    }
+}
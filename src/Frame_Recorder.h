@@ -0,0 +1,55 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Frame-Rekorder fuer die Animation eines Loeser-Laufs
+ *
+ * ************************/
+
+#ifndef FRAME_RECORDER_H
+#define FRAME_RECORDER_H
+
+#include "Flat_Graph.h"
+
+#include <vector>
+
+using namespace leda;
+
+// Records the visualization state of a solve — the flow per edge — once
+// per solver iteration, without touching GraphWin. The solve runs at
+// full speed; the recording is replayed through the window afterwards
+// at whatever frame rate the viewer wants.
+//
+// Frames are delta-encoded: frame 0 holds the initial flows, every
+// later frame only the edges an augmentation or cancellation changed.
+// A capture costs one pass over the forward arcs, but the memory grows
+// only with the changes, so even long runs on large graphs stay cheap
+// to keep around. Edges are identified by index(e) of the LEDA edge, so
+// a recording taken on the pruned solver snapshot still maps back onto
+// the full graph for replay.
+struct frame_recorder {
+    struct change { int edge_index; int flow; };
+
+    std::vector<change> changes;    // pool; frames are slices of it
+    std::vector<int> frame_first;   // frame f covers [frame_first[f],frame_first[f+1])
+    std::vector<int> last;          // last recorded flow per edge index
+
+    // Reset and record frame 0 from the current (usually flow-free)
+    // residual state
+    void start(const flat_graph& fg);
+
+    // Append one delta frame; call after every solver iteration
+    void capture(const flat_graph& fg);
+
+    // 0 both before start() ever ran and right after a reset
+    int frames() const { return frame_first.empty() ? 0 : (int)frame_first.size() - 1; }
+    int frame_begin(int f) const { return frame_first[f]; }
+    int frame_end(int f) const { return frame_first[f+1]; }
+
+    // Full flow state of frame f (indexed by edge index), rebuilt by
+    // replaying the deltas from frame 0 — for random scrubbing
+    void flow_at(int f, std::vector<int>& out) const;
+};
+
+#endif
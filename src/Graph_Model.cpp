@@ -0,0 +1,376 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Gemeinsames Graphmodell und Editor beider Programme
+ *
+ * ************************/
+
+#include <LEDA/graph/graph.h>
+#include <LEDA/graphics/graphwin.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Graph_Model.h"
+#include "Dimacs.h"
+#include "Min_Cost_Flow.h"
+#include "Solver_Thread.h"
+#include "Graph_Snapshot.h"
+#include "Gw_Batch.h"
+#include "Gw_Replay.h"
+#include "Instance_Gen.h"
+#include "Edit_Journal.h"
+
+using namespace leda;
+
+// Variables
+const color cost_c = red;
+const color cap_c = blue;
+
+static GRAPH<int,int> G;
+
+static edge_map<int> Gcost(G);
+static edge_map<int> Gcap(G);
+static edge_map<int> Gflow(G);
+
+// Background solver; the edit loop only polls it
+static solver_thread solver;
+
+// Dirty tracking for the recoloring pass: balances seen in the last
+// pass and the incrementally maintained sum over all nodes
+static node_map<int> last_balance(G);
+static node_map<bool> balance_seen(G);
+static int balance_sum = 0;
+
+// Pending GraphWin changes, applied in one redraw per flush
+static gw_batch batch;
+
+// History of slider edits for undo and headless session replay
+static edit_journal journal;
+
+// When set, the next solve fills solver.recorder with one frame per
+// iteration for the replay menu entry
+static bool record_solves = false;
+
+// Armed whenever an edit changed the graph, a balance, a cost or a
+// capacity since the last solve started; the edit loop solves again as
+// soon as the balances are consistent and the solver is free
+static bool needs_solve = true;
+
+// Layout positions carried through the snapshot, so a restarted session
+// shows the nodes where the user left them
+static node_map<double> pos_x(G);
+static node_map<double> pos_y(G);
+
+// Labels are lazy: they are only formatted for edges inside the visible
+// viewport once the zoom makes them readable. label_set tracks which
+// edges currently carry one, label_cost/label_cap the values it was
+// formatted from, so unchanged labels cost nothing per pass.
+static edge_map<bool> label_set(G);
+static edge_map<int> label_cost(G);
+static edge_map<int> label_cap(G);
+
+// Below this window scale (pixels per coordinate unit) the two-line
+// labels degenerate to unreadable smears; chosen by eye
+const double label_min_scale = 3.0;
+
+static bool has_suffix(const char* s, const char* suffix){
+    size_t ls = strlen(s), lx = strlen(suffix);
+    return ls >= lx && strcmp(s+ls-lx,suffix) == 0;
+}
+
+// True if e's label would be readable right now: zoomed in far enough
+// and at least partly inside the viewport
+static bool label_visible(GraphWin& gw, edge e){
+    window& W = gw.get_window();
+    if (W.scale() < label_min_scale) return false;
+    point p = gw.get_position(G.source(e));
+    point q = gw.get_position(G.target(e));
+    double lo_x = (p.xcoord() < q.xcoord()) ? p.xcoord() : q.xcoord();
+    double hi_x = (p.xcoord() < q.xcoord()) ? q.xcoord() : p.xcoord();
+    double lo_y = (p.ycoord() < q.ycoord()) ? p.ycoord() : q.ycoord();
+    double hi_y = (p.ycoord() < q.ycoord()) ? q.ycoord() : p.ycoord();
+    return hi_x >= W.xmin() && lo_x <= W.xmax()
+        && hi_y >= W.ymin() && lo_y <= W.ymax();
+}
+
+// Format e's label only if it is visible and its values changed since
+// the last format; clear it when it scrolls or zooms out of view
+static void refresh_label(GraphWin& gw, edge e){
+    if (label_visible(gw,e)){
+        if (!label_set[e] || label_cost[e] != Gcost[e] || label_cap[e] != Gcap[e]){
+            batch.set_label(e,string("cost = %d \n cap = %d",Gcost[e],Gcap[e]));
+            label_set[e] = true;
+            label_cost[e] = Gcost[e];
+            label_cap[e] = Gcap[e];
+        }
+    }
+    else if (label_set[e]){
+        batch.set_label(e,string());
+        label_set[e] = false;
+    }
+}
+
+// Queue width, sliders and label of an edge from its current values;
+// the caller decides when to flush
+static void update_edge(GraphWin& gw, edge e){
+    batch.set_width(e,Gcap[e]/10+5);
+    batch.set_slider_value(e,Gcap[e]/100.0,0);
+    batch.set_slider_value(e,Gcost[e]/100.0,1);
+    refresh_label(gw,e);
+}
+
+// Initialize Edge Handler
+static void init_edge(GraphWin& gw, edge e){
+    Gcap[e] = rand_int(10,20);
+    Gcost[e] = rand_int(30,50);
+    update_edge(gw,e);
+    batch.flush(gw);
+    needs_solve = true;
+}
+
+static void new_edge_handler(GraphWin& gw, edge e){
+    init_edge(gw,e);
+}
+
+// Initialize Node Handler
+static void init_node(GraphWin& gw, node n){
+    gw.set_label_type(n, gw_label_type::data_label);
+}
+
+static void new_node_handler(GraphWin& gw, node n){
+    init_node(gw, n);
+}
+
+// Keep the running balance sum correct when a node disappears
+static bool del_node_handler(GraphWin& gw, node v){
+    if (balance_seen[v]) balance_sum -= last_balance[v];
+    needs_solve = true;
+    return true;
+}
+
+// Cost Handler & Slider
+static void cost_slider_handler(GraphWin& gw, edge e, double f){
+    int v = int(100*f);
+    journal.append(index(e),edit_journal::FIELD_COST,Gcost[e],v);
+    Gcost[e] = v;
+    refresh_label(gw,e);
+    batch.flush(gw);
+    needs_solve = true;
+}
+
+// Cap Handler & Slider
+static void cap_slider_handler(GraphWin& gw,edge e, double f){
+    int v = int(100*f);
+    journal.append(index(e),edit_journal::FIELD_CAP,Gcap[e],v);
+    Gcap[e] = v;
+    batch.set_width(e,Gcap[e]/10+5);
+    refresh_label(gw,e);
+    batch.flush(gw);
+    needs_solve = true;
+}
+
+// Menu entry: take back the newest journaled edit and restore the maps
+static void undo_handler(GraphWin& gw){
+    edit_journal::record r;
+    if (!journal.undo_last(r)) return;
+    edge e;
+    forall_edges(e,G){
+        if (index(e) != r.edge_index) continue;
+        if (r.field == edit_journal::FIELD_COST) Gcost[e] = r.old_value;
+        else                                     Gcap[e]  = r.old_value;
+        update_edge(gw,e);
+        batch.flush(gw);
+        needs_solve = true;
+        return;
+    }
+}
+
+// Menu entry: toggle recording for the following solves
+static void record_handler(GraphWin& gw){
+    record_solves = !record_solves;
+    gw.message(record_solves ? "Recording the next solve."
+                             : "Recording off.");
+}
+
+// Menu entry: play the recorded solve back at viewing speed, then
+// restore the editor decoration the replay painted over
+static void replay_handler(GraphWin& gw){
+    if (solver.is_running() || solver.recorder.frames() == 0){
+        gw.message("No recorded solve to replay.");
+        return;
+    }
+    gw_replay_frames(gw,G,Gcap,solver.recorder,10);
+    edge e;
+    forall_edges(e,G){
+        label_set[e] = false;
+        update_edge(gw,e);
+    }
+    batch.flush(gw);
+}
+
+// Bulk generation for load tests: build the whole graph with the fast
+// generators before any window exists, so no handler or redraw runs per
+// edge. The per-edge handler path stays for interactive editing only.
+static void build_random_graph(int n, int m, uint64_t seed){
+    raw_instance inst = gen_netgen(n,m,n/50+1,seed);
+    std::vector<node> nodes(inst.n);
+    for (int i = 0; i < inst.n; i++)
+        nodes[i] = G.new_node(inst.balance[i]);
+    for (size_t i = 0; i < inst.src.size(); i++){
+        edge e = G.new_edge(nodes[inst.src[i]],nodes[inst.dst[i]],0);
+        Gcost[e] = inst.cost[i];
+        Gcap[e] = inst.cap[i];
+    }
+}
+
+template<mcf_algorithm ALG>
+int run_editor(const char* title, int argc, char* argv[]){
+    // Optional snapshot file: loaded at startup, written back on exit
+    const char* snapshot_path = (argc > 1) ? argv[1] : NULL;
+
+    node v;
+    edge e;
+    bool flow_synced = false;
+    bool dimacs_input = false;
+    bool have_positions = false;
+
+    // --random <n> <m> [seed]: generated load-test instance instead of
+    // a file; nothing is saved on exit
+    if (argc > 3 && strcmp(argv[1],"--random") == 0){
+        build_random_graph(atoi(argv[2]),atoi(argv[3]),
+                           (argc > 4) ? (uint64_t)atoll(argv[4]) : 1);
+        snapshot_path = NULL;
+    }
+    else if (snapshot_path != NULL){
+        // Load the instance before the window comes up, so it appears
+        // already populated; .min files are DIMACS instances, everything
+        // else is the binary snapshot format
+        dimacs_input = has_suffix(snapshot_path,".min");
+        if (dimacs_input) load_dimacs(snapshot_path,G,Gcost,Gcap);
+        else              load_snapshot(snapshot_path,G,Gcost,Gcap,
+                                        &pos_x,&pos_y,&have_positions);
+    }
+
+    // Creating Graph Window
+    GraphWin gw(G,title);
+
+    // Restore the saved layout before the window shows, so it comes up
+    // exactly like the last session ended
+    if (have_positions){
+        forall_nodes(v,G) gw.set_position(v,point(pos_x[v],pos_y[v]));
+    }
+
+    gw.display(window::center, window::center);
+    gw.set_directed(true);
+
+    // Setting Handlers
+    gw.set_new_edge_handler(new_edge_handler);
+    gw.set_new_node_handler(new_node_handler);
+    gw.set_del_node_handler(del_node_handler);
+
+    gw.set_edge_slider_handler(cost_slider_handler,1);
+    gw.set_edge_slider_color(cost_c,1);
+
+    gw.set_edge_slider_handler(cap_slider_handler,0);
+    gw.set_edge_slider_color(cap_c,0);
+
+    gw.add_simple_call(undo_handler,"Undo Edit");
+    gw.add_simple_call(record_handler,"Record Solve");
+    gw.add_simple_call(replay_handler,"Replay Solve");
+
+    // Decorate loaded edges and nodes without re-randomizing their
+    // values; one flush repaints everything at once
+    forall_edges(e,G) update_edge(gw,e);
+    forall_nodes(v,G) init_node(gw,v);
+    batch.flush(gw);
+
+    while(gw.edit()){
+        // Zoom or pan may have changed which labels are worth having;
+        // refresh_label is a cheap comparison for the unchanged ones
+        forall_edges(e,G) refresh_label(gw,e);
+
+        // One traversal: only nodes whose balance changed since the
+        // last pass get recolored, and the sum is maintained
+        // incrementally alongside
+        forall_nodes(v,G) {
+            int b = G.node_data()[v];
+            if (balance_seen[v] && last_balance[v] == b) continue;
+            balance_sum += b - (balance_seen[v] ? last_balance[v] : 0);
+            last_balance[v] = b;
+            balance_seen[v] = true;
+            needs_solve = true;
+            if (b > 0) {
+                batch.set_color(v, green);
+            }
+            else if (b < 0) {
+                batch.set_color(v, red);
+            }
+            else {
+                batch.set_color(v, grey1);
+            }
+        }
+        batch.flush(gw);
+        int balance = balance_sum;
+        if (balance != 0) {
+            gw.message("Supply/Demand values don't sum up to zero.");
+        }
+        else if (needs_solve && G.number_of_nodes() > 0 && !solver.is_running()) {
+            // Balances are consistent: solve on the background thread,
+            // the window stays interactive the whole time. Edits made
+            // while a solve runs keep needs_solve armed, so the next
+            // pass after it finishes solves again with the new values.
+            gw.message("Correct Supply Values. Solving...");
+            solver.start(G,Gcost,Gcap,ALG == ALG_CYCLE_CANCELING,record_solves);
+            needs_solve = false;
+            flow_synced = false;
+        }
+
+        // Drain the progress ring and show the latest state; never
+        // blocks on the solver
+        mcf_progress::event ev;
+        bool have_ev = false;
+        while (solver.progress.pop(ev)) have_ev = true;
+        if (have_ev && ev.phase == mcf_progress::PHASE_AUGMENT)
+            gw.message(string("Solving: %d augmentations, flow = %d",ev.iterations,ev.flow_value));
+        else if (have_ev && ev.phase == mcf_progress::PHASE_CANCEL)
+            gw.message(string("Solving: %d cycles canceled",ev.iterations));
+
+        if (solver.finished() && !flow_synced) {
+            solver.sync_flow(Gcap,Gflow);
+            flow_synced = true;
+            if (solver.result.feasible)
+                gw.message(string("Optimal: cost = %d, flow = %d",
+                                  solver.result.total_cost,solver.result.flow_value));
+            else
+                gw.message("No feasible flow for these balances.");
+        }
+    }
+
+    // DIMACS inputs are exchange files and stay read-only
+    if (snapshot_path != NULL && !dimacs_input){
+        forall_nodes(v,G){
+            point p = gw.get_position(v);
+            pos_x[v] = p.xcoord();
+            pos_y[v] = p.ycoord();
+        }
+        save_snapshot(snapshot_path,G,Gcost,Gcap,&pos_x,&pos_y);
+
+        // The journal next to the snapshot lets the headless solver
+        // replay this session's edits
+        if (!journal.empty()){
+            char jpath[1024];
+            snprintf(jpath,sizeof(jpath),"%s.journal",snapshot_path);
+            journal.save(jpath);
+        }
+    }
+
+    return 0;
+}
+
+// The two executables are the only users; instantiate both algorithms
+template int run_editor<ALG_SSP>(const char*, int, char*[]);
+template int run_editor<ALG_CYCLE_CANCELING>(const char*, int, char*[]);
@@ -0,0 +1,30 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Gemeinsames Graphmodell und Editor beider Programme
+ *
+ * ************************/
+
+#ifndef GRAPH_MODEL_H
+#define GRAPH_MODEL_H
+
+// The two visualization programs share everything — graph, cost/cap
+// maps, handlers, edit loop — and differ only in which algorithm the
+// background solver runs. The shared shell lives here once; the
+// algorithm is a template parameter, so each executable still gets its
+// choice fixed at compile time and the per-program files shrink to a
+// main() with a title.
+enum mcf_algorithm {
+    ALG_SSP = 0,
+    ALG_CYCLE_CANCELING = 1
+};
+
+// Run the interactive editor: load an optional snapshot/DIMACS instance
+// from argv[1], open the GraphWin, process edits, solve in the
+// background once the balances are consistent, save on exit.
+template<mcf_algorithm ALG>
+int run_editor(const char* title, int argc, char* argv[]);
+
+#endif
@@ -0,0 +1,108 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Erreichbarkeits-Pruning vor dem Loesen
+ *
+ * ************************/
+
+#include "Graph_Prune.h"
+
+#include <vector>
+
+// BFS over arcs with residual capacity. Forward walks the arcs as they
+// point; backward reads the capacity of the paired reverse arc, which
+// turns the same adjacency into incoming-arc traversal.
+static void reach_bfs(const flat_graph& fg, std::vector<char>& mark, bool backward){
+    std::vector<int> queue;
+    for(int v = 0; v < fg.n; v++)
+        if (mark[v]) queue.push_back(v);
+
+    for(size_t qi = 0; qi < queue.size(); qi++){
+        int u = queue[qi];
+        for(int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+            int c = backward ? fg.res[fg.rev[a]] : fg.res[a];
+            int w = fg.head[a];
+            if (c > 0 && !mark[w]){
+                mark[w] = 1;
+                queue.push_back(w);
+            }
+        }
+    }
+}
+
+int prune_flat_graph(const flat_graph& in, flat_graph& out){
+    std::vector<char> from_supply(in.n,0), to_demand(in.n,0);
+    for(int v = 0; v < in.n; v++){
+        if (in.balance[v] > 0) from_supply[v] = 1;
+        if (in.balance[v] < 0) to_demand[v] = 1;
+    }
+    reach_bfs(in,from_supply,false);
+    reach_bfs(in,to_demand,true);
+
+    // An arc stays iff flow from a supply can enter its tail and leave
+    // its head towards a demand; both endpoints of such an arc are then
+    // in both sets themselves. Balanced-zero nodes outside both sets
+    // are dropped; nodes with balance survive unconditionally so a
+    // stranded supply still turns up as infeasible.
+    std::vector<int> new_id(in.n,-1);
+    out.n = 0;
+    for(int v = 0; v < in.n; v++){
+        if (in.balance[v] != 0 || (from_supply[v] && to_demand[v]))
+            new_id[v] = out.n++;
+    }
+
+    bool have_nodes = !in.node_of.empty();
+    out.node_of.assign(have_nodes ? out.n : 0,nil);
+    out.balance.assign(out.n,0);
+    for(int v = 0; v < in.n; v++){
+        if (new_id[v] == -1) continue;
+        out.balance[new_id[v]] = in.balance[v];
+        if (have_nodes) out.node_of[new_id[v]] = in.node_of[v];
+    }
+
+    // Counting pass over the surviving edges, mirroring build()
+    out.first_out.assign(out.n+1,0);
+    int kept = 0;
+    for(int u = 0; u < in.n; u++){
+        for(int a = in.first_out[u]; a < in.first_out[u+1]; a++){
+            if (!in.forward[a] || in.res[a] <= 0) continue;
+            int w = in.head[a];
+            if (!from_supply[u] || !to_demand[w]) continue;
+            out.first_out[new_id[u]+1]++;
+            out.first_out[new_id[w]+1]++;
+            kept++;
+        }
+    }
+    for(int u = 0; u < out.n; u++) out.first_out[u+1] += out.first_out[u];
+
+    out.m = 2*kept;
+    out.head.assign(out.m,0);
+    out.cost.assign(out.m,0);
+    out.res.assign(out.m,0);
+    out.rev.assign(out.m,0);
+    out.forward.assign(out.m,0);
+    out.edge_of.assign(out.m,nil);
+    out.arc_of.assign(in.arc_of.size(),-1);
+
+    std::vector<int> next(out.first_out.begin(), out.first_out.end()-1);
+    for(int u = 0; u < in.n; u++){
+        for(int oa = in.first_out[u]; oa < in.first_out[u+1]; oa++){
+            if (!in.forward[oa] || in.res[oa] <= 0) continue;
+            int w = in.head[oa];
+            if (!from_supply[u] || !to_demand[w]) continue;
+            int nu = new_id[u], nw = new_id[w];
+            int a = next[nu]++;     // forward arc
+            int b = next[nw]++;     // backward arc
+            out.head[a] = nw;  out.cost[a] =  in.cost[oa];  out.res[a] = in.res[oa];  out.rev[a] = b;
+            out.head[b] = nu;  out.cost[b] = -in.cost[oa];  out.res[b] = 0;           out.rev[b] = a;
+            out.forward[a] = 1;
+            edge e = in.edge_of[oa];
+            out.edge_of[a] = e;
+            if (e != nil) out.arc_of[index(e)] = a;
+        }
+    }
+
+    return in.m/2 - kept;
+}
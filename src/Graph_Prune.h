@@ -0,0 +1,30 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Erreichbarkeits-Pruning vor dem Loesen
+ *
+ * ************************/
+
+#ifndef GRAPH_PRUNE_H
+#define GRAPH_PRUNE_H
+
+#include "Flat_Graph.h"
+
+// Preprocessing stage for a freshly built, unsolved snapshot: an arc
+// can only ever carry flow if its tail is forward-reachable from some
+// supply node and its head reaches some demand node through residual
+// capacity. Two BFS passes over the CSR arrays find those sets — the
+// backward one walks rev[] pairs, so no reverse adjacency is needed —
+// and everything else is dropped from the copy in `out`.
+//
+// Nodes with non-zero balance always survive, so an unservable supply
+// still shows up as infeasible instead of being silently deleted. The
+// node_of/edge_of/arc_of back-references carry over, which keeps
+// sync_flow working on the pruned graph; pruned edges keep flow 0.
+//
+// Returns the number of edges removed.
+int prune_flat_graph(const flat_graph& in, flat_graph& out);
+
+#endif
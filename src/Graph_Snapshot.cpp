@@ -0,0 +1,154 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Binaeres Snapshot-Format zum Speichern und Laden von Instanzen
+ *
+ * ************************/
+
+#include "Graph_Snapshot.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Variables
+const int SNAPSHOT_MAGIC       = 0x4746434D;   // "MCFG", little endian
+const int SNAPSHOT_VERSION     = 1;
+const int SNAPSHOT_VERSION_POS = 2;            // with layout positions
+
+bool save_snapshot(const char* path, GRAPH<int,int>& G,
+                   const edge_map<int>& Gcost, const edge_map<int>& Gcap,
+                   const node_map<double>* pos_x,
+                   const node_map<double>* pos_y){
+    FILE* f = fopen(path,"wb");
+    if (f == NULL) return false;
+
+    int n = G.number_of_nodes();
+    int m = G.number_of_edges();
+
+    node v;
+    edge e;
+
+    bool with_pos = (pos_x != NULL && pos_y != NULL);
+
+    // Number the nodes so the edge records can refer to them
+    node_array<int> num(G);
+    std::vector<int> balance(n);
+    std::vector<double> x(with_pos ? n : 0), y(with_pos ? n : 0);
+    int i = 0;
+    forall_nodes(v,G){
+        num[v] = i;
+        balance[i] = G.node_data()[v];
+        if (with_pos){
+            x[i] = (*pos_x)[v];
+            y[i] = (*pos_y)[v];
+        }
+        i++;
+    }
+
+    std::vector<int> src(m), dst(m), cost(m), cap(m);
+    i = 0;
+    forall_edges(e,G){
+        src[i]  = num[G.source(e)];
+        dst[i]  = num[G.target(e)];
+        cost[i] = Gcost[e];
+        cap[i]  = Gcap[e];
+        i++;
+    }
+
+    int header[4] = { SNAPSHOT_MAGIC,
+                      with_pos ? SNAPSHOT_VERSION_POS : SNAPSHOT_VERSION, n, m };
+    bool ok = fwrite(header,sizeof(int),4,f) == 4
+           && fwrite(balance.data(),sizeof(int),n,f) == (size_t)n
+           && fwrite(src.data(),sizeof(int),m,f)  == (size_t)m
+           && fwrite(dst.data(),sizeof(int),m,f)  == (size_t)m
+           && fwrite(cost.data(),sizeof(int),m,f) == (size_t)m
+           && fwrite(cap.data(),sizeof(int),m,f)  == (size_t)m;
+    if (ok && with_pos)
+        ok = fwrite(x.data(),sizeof(double),n,f) == (size_t)n
+          && fwrite(y.data(),sizeof(double),n,f) == (size_t)n;
+    fclose(f);
+    return ok;
+}
+
+bool load_snapshot(const char* path, GRAPH<int,int>& G,
+                   edge_map<int>& Gcost, edge_map<int>& Gcap,
+                   node_map<double>* pos_x, node_map<double>* pos_y,
+                   bool* have_positions){
+    if (have_positions != NULL) *have_positions = false;
+    int fd = open(path,O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd,&st) < 0 || (size_t)st.st_size < 4*sizeof(int)){
+        close(fd);
+        return false;
+    }
+
+    // Map the whole file read-only; the arrays below point straight into
+    // the mapping, nothing is copied before insertion
+    const int* data = (const int*) mmap(NULL,st.st_size,PROT_READ,MAP_PRIVATE,fd,0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    int version = data[1];
+    int n = data[2];
+    int m = data[3];
+    size_t expected = (4 + (size_t)n + 4*(size_t)m) * sizeof(int);
+    if (version == SNAPSHOT_VERSION_POS)
+        expected += 2*(size_t)n*sizeof(double);
+    if (data[0] != SNAPSHOT_MAGIC ||
+        (version != SNAPSHOT_VERSION && version != SNAPSHOT_VERSION_POS) ||
+        n < 0 || m < 0 || (size_t)st.st_size < expected){
+        munmap((void*)data,st.st_size);
+        return false;
+    }
+
+    const int* balance = data + 4;
+    const int* src     = balance + n;
+    const int* dst     = src + m;
+    const int* cost    = dst + m;
+    const int* cap     = cost + m;
+
+    // A file of plausible size can still carry node ids outside [0,n)
+    // after truncation or corruption; reject it like the DIMACS reader
+    // does instead of indexing node_of out of bounds
+    for(int i = 0; i < m; i++){
+        if (src[i] < 0 || src[i] >= n || dst[i] < 0 || dst[i] >= n){
+            munmap((void*)data,st.st_size);
+            return false;
+        }
+    }
+
+    G.clear();
+    std::vector<node> node_of(n);
+    for(int i = 0; i < n; i++) node_of[i] = G.new_node(balance[i]);
+    for(int i = 0; i < m; i++){
+        edge e = G.new_edge(node_of[src[i]],node_of[dst[i]]);
+        Gcost[e] = cost[i];
+        Gcap[e]  = cap[i];
+    }
+
+    if (version == SNAPSHOT_VERSION_POS && pos_x != NULL && pos_y != NULL){
+        // The position block starts right after the int arrays and is
+        // not necessarily 8-byte aligned in the mapping, so copy
+        const char* raw = (const char*)(cap + m);
+        std::vector<double> xy(2*(size_t)n);
+        memcpy(xy.data(),raw,2*(size_t)n*sizeof(double));
+        for(int i = 0; i < n; i++){
+            (*pos_x)[node_of[i]] = xy[i];
+            (*pos_y)[node_of[i]] = xy[n+i];
+        }
+        if (have_positions != NULL) *have_positions = true;
+    }
+
+    munmap((void*)data,st.st_size);
+    return true;
+}
@@ -0,0 +1,52 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Binaeres Snapshot-Format zum Speichern und Laden von Instanzen
+ *
+ * ************************/
+
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include <LEDA/graph/graph.h>
+
+using namespace leda;
+
+// Compact binary instance format so large graphs do not have to be
+// rebuilt edge by edge through the GraphWin handlers. The file is a
+// fixed-width header followed by contiguous arrays:
+//
+//   int32 magic ('M','C','F','G'), int32 version, int32 n, int32 m
+//   int32 balance[n]
+//   int32 src[m], int32 dst[m], int32 cost[m], int32 cap[m]
+//   double x[n], double y[n]          (version 2 only)
+//
+// Version 2 appends the layout positions, so a session restarts with
+// the nodes exactly where the user left them. Version 1 files still
+// load; their nodes get the default layout.
+//
+// Loading maps the whole file read-only and bulk-inserts into G, so a
+// multi-million-edge instance is available right after startup.
+
+// Write G with its cost/cap maps and node balances to path. If pos_x
+// and pos_y are given the layout is stored too (version 2), otherwise a
+// version 1 file is written. Returns false if the file cannot be
+// written.
+bool save_snapshot(const char* path, GRAPH<int,int>& G,
+                   const edge_map<int>& Gcost, const edge_map<int>& Gcap,
+                   const node_map<double>* pos_x = NULL,
+                   const node_map<double>* pos_y = NULL);
+
+// Clear G and rebuild it from the snapshot at path via mmap. If the
+// file carries positions and pos_x/pos_y are given, they are filled and
+// *have_positions is set. Returns false if the file is missing or
+// malformed.
+bool load_snapshot(const char* path, GRAPH<int,int>& G,
+                   edge_map<int>& Gcost, edge_map<int>& Gcap,
+                   node_map<double>* pos_x = NULL,
+                   node_map<double>* pos_y = NULL,
+                   bool* have_positions = NULL);
+
+#endif
@@ -0,0 +1,29 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Gesammelte GraphWin-Updates statt Einzel-Redraws
+ *
+ * ************************/
+
+#include "Gw_Batch.h"
+
+void gw_batch::flush(GraphWin& gw){
+    if (empty()) return;
+
+    bool old_flush = gw.set_flush(false);
+
+    for(const width_change& c : widths)       gw.set_width(c.e,c.width);
+    for(const slider_change& c : sliders)     gw.set_slider_value(c.e,c.value,c.slider);
+    for(const label_change& c : labels)       gw.set_label(c.e,c.label);
+    for(const color_change& c : node_colors)  gw.set_color(c.v,c.col);
+
+    widths.clear();
+    sliders.clear();
+    labels.clear();
+    node_colors.clear();
+
+    gw.set_flush(old_flush);
+    gw.redraw();
+}
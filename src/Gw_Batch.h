@@ -0,0 +1,48 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Gesammelte GraphWin-Updates statt Einzel-Redraws
+ *
+ * ************************/
+
+#ifndef GW_BATCH_H
+#define GW_BATCH_H
+
+#include <LEDA/graphics/graphwin.h>
+#include <vector>
+
+using namespace leda;
+
+// Every gw.set_label/set_width/set_color call triggers GraphWin redraw
+// work of its own, so decorating or recoloring a large graph repaints
+// thousands of times. A gw_batch collects the pending changes and
+// applies them in one transaction: drawing is switched off with
+// gw.set_flush(false), all queued changes are written, and a single
+// redraw shows the result.
+struct gw_batch {
+    struct label_change  { edge e; string label; };
+    struct width_change  { edge e; int width; };
+    struct slider_change { edge e; double value; int slider; };
+    struct color_change  { node v; color col; };
+
+    std::vector<label_change>  labels;
+    std::vector<width_change>  widths;
+    std::vector<slider_change> sliders;
+    std::vector<color_change>  node_colors;
+
+    void set_label(edge e, const string& s)            { labels.push_back({e,s}); }
+    void set_width(edge e, int w)                      { widths.push_back({e,w}); }
+    void set_slider_value(edge e, double f, int slider){ sliders.push_back({e,f,slider}); }
+    void set_color(node v, color c)                    { node_colors.push_back({v,c}); }
+
+    bool empty() const {
+        return labels.empty() && widths.empty() && sliders.empty() && node_colors.empty();
+    }
+
+    // Apply all queued changes inside one redraw and clear the batch
+    void flush(GraphWin& gw);
+};
+
+#endif
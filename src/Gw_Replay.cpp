@@ -0,0 +1,61 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Wiedergabe aufgezeichneter Loeser-Frames im GraphWin
+ *
+ * ************************/
+
+#include "Gw_Replay.h"
+#include "Gw_Batch.h"
+
+#include <vector>
+
+// Width and label of an edge carrying the given flow; the width formula
+// matches the capacity-based one from the editor so the picture does
+// not jump between editing and replay
+static void queue_edge(gw_batch& batch, edge e, int flow, int cap){
+    batch.set_width(e,flow/10+2);
+    batch.set_label(e,string("flow = %d / %d",flow,cap));
+}
+
+void gw_replay_frames(GraphWin& gw, GRAPH<int,int>& G,
+                      const edge_map<int>& Gcap,
+                      const frame_recorder& rec, double fps){
+    if (rec.frames() == 0) return;
+    if (fps <= 0) fps = 10;
+
+    // index(e) -> edge lookup, the inverse of what the recorder stored
+    std::vector<edge> edge_at;
+    edge e;
+    forall_edges(e,G){
+        if (index(e) >= (int)edge_at.size()) edge_at.resize(index(e)+1,nil);
+        edge_at[index(e)] = e;
+    }
+
+    gw_batch batch;
+
+    // Frame 0: full state, so the replay starts from a clean picture
+    // even if the window currently shows a finished flow
+    std::vector<int> flow;
+    rec.flow_at(0,flow);
+    forall_edges(e,G){
+        int f = (index(e) < (int)flow.size()) ? flow[index(e)] : 0;
+        queue_edge(batch,e,f,Gcap[e]);
+    }
+    batch.flush(gw);
+
+    for(int f = 1; f < rec.frames(); f++){
+        leda_wait(1.0/fps);
+        for(int i = rec.frame_begin(f); i < rec.frame_end(f); i++){
+            const frame_recorder::change& c = rec.changes[i];
+            if (c.edge_index >= (int)edge_at.size()) continue;
+            edge ce = edge_at[c.edge_index];
+            if (ce == nil) continue;
+            queue_edge(batch,ce,c.flow,Gcap[ce]);
+        }
+        batch.flush(gw);
+        gw.message(string("Replay: frame %d / %d",f+1,rec.frames()));
+    }
+}
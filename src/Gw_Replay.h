@@ -0,0 +1,30 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Wiedergabe aufgezeichneter Loeser-Frames im GraphWin
+ *
+ * ************************/
+
+#ifndef GW_REPLAY_H
+#define GW_REPLAY_H
+
+#include <LEDA/graphics/graphwin.h>
+
+#include "Frame_Recorder.h"
+
+using namespace leda;
+
+// Plays a recording back through the window: frame 0 paints the full
+// initial flow state, every later frame touches only the edges its
+// delta lists, one batched redraw per frame. The frame rate is the
+// viewer's choice and completely decoupled from how fast the solve ran.
+// Edge widths and labels show the flow against the capacity; the
+// caller re-decorates the edges afterwards (the replay leaves flow
+// labels behind).
+void gw_replay_frames(GraphWin& gw, GRAPH<int,int>& G,
+                      const edge_map<int>& Gcap,
+                      const frame_recorder& rec, double fps);
+
+#endif
@@ -0,0 +1,135 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Instanz-Generatoren fuer Benchmarks und Lasttests
+ *
+ * ************************/
+
+#include "Instance_Gen.h"
+
+static uint64_t splitmix64(uint64_t& x){
+    uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+xoshiro256::xoshiro256(uint64_t seed){
+    for(int i = 0; i < 4; i++) s[i] = splitmix64(seed);
+}
+
+static uint64_t rotl(uint64_t x, int k){
+    return (x << k) | (x >> (64 - k));
+}
+
+uint64_t xoshiro256::next(){
+    uint64_t result = rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = rotl(s[3],45);
+    return result;
+}
+
+raw_instance gen_grid(int k, uint64_t seed){
+    xoshiro256 rng(seed);
+    raw_instance inst;
+    inst.n = k*k;
+    inst.balance.assign(inst.n,0);
+
+    for(int row = 0; row < k; row++){
+        for(int col = 0; col < k; col++){
+            int v = row*k + col;
+            if (col+1 < k){
+                inst.src.push_back(v);
+                inst.dst.push_back(v+1);
+                inst.cost.push_back(rng.next_int(30,50));
+                inst.cap.push_back(rng.next_int(10,20));
+            }
+            if (row+1 < k){
+                inst.src.push_back(v);
+                inst.dst.push_back(v+k);
+                inst.cost.push_back(rng.next_int(30,50));
+                inst.cap.push_back(rng.next_int(10,20));
+            }
+        }
+    }
+
+    // Corner-to-corner demand, small enough that grids stay feasible
+    inst.balance[0] = 10;
+    inst.balance[inst.n-1] = -10;
+    return inst;
+}
+
+raw_instance gen_transport(int s, int t, int density, uint64_t seed){
+    xoshiro256 rng(seed);
+    raw_instance inst;
+    inst.n = s + t;
+    inst.balance.assign(inst.n,0);
+
+    // Each supply is mirrored by a demand at column (i mod t), and the
+    // dedicated arc below can carry it in full, so the instance is
+    // feasible by construction
+    for(int i = 0; i < s; i++){
+        int b = rng.next_int(1,10);
+        inst.balance[i] = b;
+        inst.balance[s + i%t] -= b;
+    }
+
+    for(int i = 0; i < s; i++){
+        // Dedicated arc to the mirrored demand column, then density-1
+        // random arcs for the solver to trade against
+        inst.src.push_back(i);
+        inst.dst.push_back(s + i%t);
+        inst.cost.push_back(rng.next_int(1,100));
+        inst.cap.push_back(inst.balance[i]);
+        for(int d = 1; d < density; d++){
+            inst.src.push_back(i);
+            inst.dst.push_back(s + rng.next_int(0,t-1));
+            inst.cost.push_back(rng.next_int(1,100));
+            inst.cap.push_back(rng.next_int(5,50));
+        }
+    }
+    return inst;
+}
+
+raw_instance gen_netgen(int n, int m, int supplies, uint64_t seed){
+    xoshiro256 rng(seed);
+    raw_instance inst;
+    inst.n = n;
+    inst.balance.assign(n,0);
+
+    int per_node = 5;
+    for(int i = 0; i < supplies && i < n/2; i++){
+        inst.balance[i] = per_node;
+        inst.balance[n-1-i] = -per_node;
+    }
+    int total = per_node * (supplies < n/2 ? supplies : n/2);
+
+    // Skeleton path 0 -> 1 -> ... -> n-1 with enough capacity to route
+    // everything, so the instance is feasible by construction
+    for(int v = 0; v+1 < n; v++){
+        inst.src.push_back(v);
+        inst.dst.push_back(v+1);
+        inst.cost.push_back(rng.next_int(50,100));
+        inst.cap.push_back(total);
+    }
+
+    // Remaining arcs are uniform random, cheaper than the skeleton on
+    // average so the solver has something to discover
+    for(int i = n-1; i < m; i++){
+        int u = rng.next_int(0,n-1);
+        int w = rng.next_int(0,n-1);
+        if (u == w) w = (w+1) % n;
+        inst.src.push_back(u);
+        inst.dst.push_back(w);
+        inst.cost.push_back(rng.next_int(1,80));
+        inst.cap.push_back(rng.next_int(5,30));
+    }
+    return inst;
+}
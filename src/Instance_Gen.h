@@ -0,0 +1,54 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Instanz-Generatoren fuer Benchmarks und Lasttests
+ *
+ * ************************/
+
+#ifndef INSTANCE_GEN_H
+#define INSTANCE_GEN_H
+
+#include <cstdint>
+#include <vector>
+
+// Parameterized min-cost-flow instance generators, independent of LEDA
+// so they also feed the headless benchmark targets. All instances come
+// back as raw edge arrays ready for flat_graph::build_raw.
+
+// Raw instance: edge i runs src[i] -> dst[i] with cost[i] and cap[i]
+struct raw_instance {
+    int n;
+    std::vector<int> src, dst, cost, cap;
+    std::vector<int> balance;
+};
+
+// xoshiro256** — a fast PRNG for bulk generation; LEDA's rand_int is
+// far too slow for millions of edges
+struct xoshiro256 {
+    uint64_t s[4];
+
+    explicit xoshiro256(uint64_t seed);
+
+    uint64_t next();
+
+    // Uniform int in [lo,hi]
+    int next_int(int lo, int hi){
+        return lo + (int)(next() % (uint64_t)(hi - lo + 1));
+    }
+};
+
+// k x k grid network: every node has arcs to its right and lower
+// neighbour, supply in the top-left corner, demand in the bottom-right
+raw_instance gen_grid(int k, uint64_t seed);
+
+// Random bipartite transportation problem with s supply and t demand
+// nodes and roughly density arcs per supply node
+raw_instance gen_transport(int s, int t, int density, uint64_t seed);
+
+// NETGEN-style random network: a random skeleton path through all nodes
+// guarantees feasibility, the remaining arcs are random
+raw_instance gen_netgen(int n, int m, int supplies, uint64_t seed);
+
+#endif
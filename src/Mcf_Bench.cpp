@@ -0,0 +1,195 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Benchmark-Programm fuer beide Solver-Kerne
+ *
+ * ************************/
+
+#include "Instance_Gen.h"
+#include "Min_Cost_Flow.h"
+#include "Network_Simplex.h"
+#include "Shortest_Path.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <sys/resource.h>
+
+// Peak resident set size in kilobytes
+static long peak_rss_kb(){
+    struct rusage ru;
+    getrusage(RUSAGE_SELF,&ru);
+    return ru.ru_maxrss;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point t0){
+    return std::chrono::duration<double,std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+}
+
+// One benchmark row per algorithm run, machine-readable CSV on stdout
+static void run_instance(const char* generator, const raw_instance& inst){
+    flat_graph base;
+    base.build_raw(inst.n,inst.src,inst.dst,inst.cost,inst.cap,inst.balance);
+
+    // Successive Shortest Path
+    {
+        flat_graph fg = base;
+        std::vector<int> excess(fg.balance);
+        std::vector<int> pot(fg.n,0);
+        bool feasible = false;
+        int augmentations = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        mcf_ssp_core(fg,excess,pot,feasible,&augmentations);
+        double ms = elapsed_ms(t0);
+
+        // Correctness gate, outside the timed region: the solve's own
+        // potentials must certify the flow
+        if (feasible){
+            int bad = mcf_check_optimality(fg,pot.data());
+            if (bad != -1)
+                fprintf(stderr,"%s,%d: ssp optimality check failed at arc %d\n",
+                        generator,inst.n,bad);
+        }
+
+        printf("%s,%d,%zu,ssp,%.3f,%d,%d,%d,%ld\n",
+               generator,inst.n,inst.src.size(),ms,
+               mcf_flat_cost(fg),feasible?1:0,augmentations,peak_rss_kb());
+    }
+
+    // Phase-parallel SSP: the iteration column counts committed
+    // augmenting paths across all phases plus the sequential tail
+    {
+        flat_graph fg = base;
+        std::vector<int> excess(fg.balance);
+        std::vector<int> pot(fg.n,0);
+        bool feasible = false;
+        int augmentations = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        mcf_ssp_core_parallel(fg,excess,pot,feasible,0,&augmentations);
+        double ms = elapsed_ms(t0);
+
+        if (feasible){
+            int bad = mcf_check_optimality(fg,pot.data());
+            if (bad != -1)
+                fprintf(stderr,"%s,%d: ssp_parallel optimality check failed at arc %d\n",
+                        generator,inst.n,bad);
+        }
+
+        printf("%s,%d,%zu,ssp_parallel,%.3f,%d,%d,%d,%ld\n",
+               generator,inst.n,inst.src.size(),ms,
+               mcf_flat_cost(fg),feasible?1:0,augmentations,peak_rss_kb());
+    }
+
+    // Cycle Canceling: feasible flow on a zero-cost copy first, then the
+    // real costs are restored and the cancellation loop does the work
+    {
+        flat_graph fg = base;
+        for(int a = 0; a < fg.m; a++) fg.cost[a] = 0;
+        std::vector<int> excess(fg.balance);
+        std::vector<int> pot(fg.n,0);
+        bool feasible = false;
+        int cancellations = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        mcf_ssp_core(fg,excess,pot,feasible);
+        fg.cost = base.cost;
+        if (feasible) mcf_cancel_negative_cycles(fg,&cancellations);
+        double ms = elapsed_ms(t0);
+
+        // Cycle canceling keeps no potentials, so certify with shortest
+        // distances from the all-zero virtual source instead
+        if (feasible){
+            std::vector<int> dist(fg.n,0), pred(fg.n,-1);
+            bellman_ford(fg,dist.data(),pred.data());
+            int bad = mcf_check_optimality(fg,dist.data());
+            if (bad != -1)
+                fprintf(stderr,"%s,%d: cycle canceling optimality check failed at arc %d\n",
+                        generator,inst.n,bad);
+        }
+
+        printf("%s,%d,%zu,cycle_canceling,%.3f,%d,%d,%d,%ld\n",
+               generator,inst.n,inst.src.size(),ms,
+               mcf_flat_cost(fg),feasible?1:0,cancellations,peak_rss_kb());
+    }
+
+    // Minimum mean cycle canceling: same cost-blind feasibility flow,
+    // but every cancellation picks a Karp minimum mean cycle
+    {
+        flat_graph fg = base;
+        for(int a = 0; a < fg.m; a++) fg.cost[a] = 0;
+        std::vector<int> excess(fg.balance);
+        std::vector<int> pot(fg.n,0);
+        bool feasible = false;
+        int cancellations = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        mcf_ssp_core(fg,excess,pot,feasible);
+        fg.cost = base.cost;
+        if (feasible) mcf_cancel_min_mean_cycles(fg,&cancellations);
+        double ms = elapsed_ms(t0);
+
+        if (feasible){
+            std::vector<int> dist(fg.n,0), pred(fg.n,-1);
+            bellman_ford(fg,dist.data(),pred.data());
+            int bad = mcf_check_optimality(fg,dist.data());
+            if (bad != -1)
+                fprintf(stderr,"%s,%d: min mean canceling optimality check failed at arc %d\n",
+                        generator,inst.n,bad);
+        }
+
+        printf("%s,%d,%zu,min_mean_canceling,%.3f,%d,%d,%d,%ld\n",
+               generator,inst.n,inst.src.size(),ms,
+               mcf_flat_cost(fg),feasible?1:0,cancellations,peak_rss_kb());
+    }
+
+    // Network Simplex
+    {
+        flat_graph fg = base;
+        bool feasible = false;
+        int pivots = 0;
+
+        auto t0 = std::chrono::steady_clock::now();
+        mcf_network_simplex(fg,feasible,&pivots);
+        double ms = elapsed_ms(t0);
+
+        if (feasible){
+            std::vector<int> dist(fg.n,0), pred(fg.n,-1);
+            bellman_ford(fg,dist.data(),pred.data());
+            int bad = mcf_check_optimality(fg,dist.data());
+            if (bad != -1)
+                fprintf(stderr,"%s,%d: network simplex optimality check failed at arc %d\n",
+                        generator,inst.n,bad);
+        }
+
+        printf("%s,%d,%zu,network_simplex,%.3f,%d,%d,%d,%ld\n",
+               generator,inst.n,inst.src.size(),ms,
+               mcf_flat_cost(fg),feasible?1:0,pivots,peak_rss_kb());
+    }
+}
+
+int main(int argc, char* argv[]){
+    // Upper bound on instance size, so the full 5M-edge sweep only runs
+    // when asked for
+    long max_edges = (argc > 1) ? atol(argv[1]) : 100000;
+    uint64_t seed = (argc > 2) ? strtoull(argv[2],NULL,10) : 42;
+
+    printf("generator,nodes,edges,algorithm,time_ms,cost,feasible,iterations,peak_rss_kb\n");
+
+    for(int k = 16; 2L*k*(k-1) <= max_edges; k *= 2)
+        run_instance("grid",gen_grid(k,seed));
+
+    for(int s = 100; 10L*s <= max_edges; s *= 10)
+        run_instance("transport",gen_transport(s,s,10,seed));
+
+    for(long m = 1000; m <= max_edges; m *= 10)
+        run_instance("netgen",gen_netgen((int)(m/10),(int)m,(int)(m/100),seed));
+
+    return 0;
+}
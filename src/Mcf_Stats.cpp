@@ -0,0 +1,55 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Zaehler und Zeitmessung auf dem Solver-Hot-Path
+ *
+ * ************************/
+
+#include "Mcf_Stats.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+mcf_stats g_mcf_stats;
+
+unsigned long long mcf_ticks(){
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return (unsigned long long)
+        std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+}
+
+void mcf_stats::reset(){
+    sp_calls.store(0,std::memory_order_relaxed);
+    nodes_scanned.store(0,std::memory_order_relaxed);
+    heap_inserts.store(0,std::memory_order_relaxed);
+    relaxations.store(0,std::memory_order_relaxed);
+    augmentations.store(0,std::memory_order_relaxed);
+    cancellations.store(0,std::memory_order_relaxed);
+    flow_pushed.store(0,std::memory_order_relaxed);
+    augment_ticks.store(0,std::memory_order_relaxed);
+    cancel_ticks.store(0,std::memory_order_relaxed);
+}
+
+void mcf_stats::dump_json(FILE* f) const {
+    fprintf(f,
+        "{\"sp_calls\":%llu,\"nodes_scanned\":%llu,\"heap_inserts\":%llu,"
+        "\"relaxations\":%llu,\"augmentations\":%llu,\"cancellations\":%llu,"
+        "\"flow_pushed\":%llu,\"augment_ticks\":%llu,\"cancel_ticks\":%llu}\n",
+        sp_calls.load(std::memory_order_relaxed),
+        nodes_scanned.load(std::memory_order_relaxed),
+        heap_inserts.load(std::memory_order_relaxed),
+        relaxations.load(std::memory_order_relaxed),
+        augmentations.load(std::memory_order_relaxed),
+        cancellations.load(std::memory_order_relaxed),
+        flow_pushed.load(std::memory_order_relaxed),
+        augment_ticks.load(std::memory_order_relaxed),
+        cancel_ticks.load(std::memory_order_relaxed));
+}
@@ -0,0 +1,57 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Zaehler und Zeitmessung auf dem Solver-Hot-Path
+ *
+ * ************************/
+
+#ifndef MCF_STATS_H
+#define MCF_STATS_H
+
+#include <atomic>
+#include <cstdio>
+
+// Cheap instrumentation for the solver cores. All updates go through
+// the MCF_STAT_* macros, which compile to nothing unless the build
+// defines MCF_STATS (see the option in CMakeLists.txt), so release
+// binaries carry no counter loads or stores at all. The counters are a
+// single global, but the parallel cores (scenario sweep, phase-parallel
+// SSP, parallel cycle detection) update them from several threads at
+// once, so every field is a relaxed atomic: no ordering, just no lost
+// or torn updates.
+struct mcf_stats {
+    std::atomic<unsigned long long> sp_calls;        // shortest-path computations
+    std::atomic<unsigned long long> nodes_scanned;   // heap extractions / queue pops
+    std::atomic<unsigned long long> heap_inserts;    // insert_or_decrease calls
+    std::atomic<unsigned long long> relaxations;     // successful arc relaxations
+    std::atomic<unsigned long long> augmentations;   // augmenting paths applied
+    std::atomic<unsigned long long> cancellations;   // negative cycles canceled
+    std::atomic<unsigned long long> flow_pushed;     // units over all paths and cycles
+    std::atomic<unsigned long long> augment_ticks;   // rdtsc spent in the SSP phase
+    std::atomic<unsigned long long> cancel_ticks;    // rdtsc spent canceling cycles
+
+    void reset();
+    void dump_json(FILE* f) const;
+};
+
+extern mcf_stats g_mcf_stats;
+
+// Time stamp counter; cycle-accurate on x86, a monotonic tick count
+// elsewhere. Only meaningful as differences.
+unsigned long long mcf_ticks();
+
+#ifdef MCF_STATS
+#define MCF_STAT_ADD(field,v)        (g_mcf_stats.field.fetch_add((unsigned long long)(v),std::memory_order_relaxed))
+#define MCF_STAT_TICKS_BEGIN(var)    unsigned long long var = mcf_ticks()
+#define MCF_STAT_TICKS_END(field,var) (g_mcf_stats.field.fetch_add(mcf_ticks() - (var),std::memory_order_relaxed))
+#else
+#define MCF_STAT_ADD(field,v)        ((void)0)
+#define MCF_STAT_TICKS_BEGIN(var)    ((void)0)
+#define MCF_STAT_TICKS_END(field,var) ((void)0)
+#endif
+
+#define MCF_STAT_INC(field) MCF_STAT_ADD(field,1)
+
+#endif
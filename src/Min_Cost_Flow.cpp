@@ -0,0 +1,599 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Headless Solver Engine (ohne GraphWin)
+ *
+ * ************************/
+
+#include "Min_Cost_Flow.h"
+#include "Flat_Graph.h"
+#include "Shortest_Path.h"
+#include "Cycle_Detect.h"
+#include "Arena.h"
+#include "Frame_Recorder.h"
+#include "Mcf_Stats.h"
+
+#include <thread>
+#include <vector>
+
+// Variables
+const int INF = SP_INF;
+
+// Both solver cores run on the flat_graph snapshot: one build pass over
+// the LEDA structures up front, one sync pass at the end, and in between
+// only contiguous-array accesses on the hot path.
+
+// Push flow along the predecessor path ending in t. tail_of[a] gives the
+// tail node of arc a via its reverse arc's head.
+static int augment_path(flat_graph& fg, const int* pred_arc,
+                        int t, int delta){
+    int bottleneck = delta;
+    int v = t;
+    while (pred_arc[v] != -1){
+        int a = pred_arc[v];
+        if (fg.res[a] < bottleneck) bottleneck = fg.res[a];
+        v = fg.head[fg.rev[a]];
+    }
+    v = t;
+    while (pred_arc[v] != -1){
+        int a = pred_arc[v];
+        fg.res[a] -= bottleneck;
+        fg.res[fg.rev[a]] += bottleneck;
+        v = fg.head[fg.rev[a]];
+    }
+    return bottleneck;
+}
+
+static int flow_cost(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                     const edge_map<int>& Gflow){
+    int total = 0;
+    edge e;
+    forall_edges(e,G) total += Gcost[e] * Gflow[e];
+    return total;
+}
+
+int mcf_flat_cost(const flat_graph& fg){
+    int total = 0;
+    for(int a = 0; a < fg.m; a++){
+        if (fg.forward[a]) total += fg.cost[a] * fg.res[fg.rev[a]];
+    }
+    return total;
+}
+
+int mcf_check_optimality(const flat_graph& fg, const int* pot){
+    // Blocks are OR-combined without branches, so the inner loop is a
+    // straight pass over cost/res/head the compiler can vectorize; the
+    // scalar rescan only runs for a block that actually violates
+    const int B = 128;
+    for(int u = 0; u < fg.n; u++){
+        int pu = pot[u];
+        int hi = fg.first_out[u+1];
+        for(int b = fg.first_out[u]; b < hi; b += B){
+            int e = (b + B < hi) ? b + B : hi;
+            int bad = 0;
+            for(int a = b; a < e; a++)
+                bad |= (fg.res[a] > 0) & (fg.cost[a] + pu - pot[fg.head[a]] < 0);
+            if (bad){
+                for(int a = b; a < e; a++)
+                    if (fg.res[a] > 0 && fg.cost[a] + pu - pot[fg.head[a]] < 0)
+                        return a;
+            }
+        }
+    }
+    return -1;
+}
+
+// SSP core over an already-built snapshot. Returns the routed flow value
+// and leaves the residual capacities in fg.
+// Node potentials keep all reduced costs non-negative, so every
+// augmentation can use Dijkstra instead of Bellman-Ford. Edge costs
+// from the sliders and generators are non-negative, so the all-zero
+// start is usually valid already; costs loaded from DIMACS files may be
+// negative and get repaired up front. excess and pot are in/out so a
+// warm start can resume from a previous solve's state.
+int mcf_ssp_core(flat_graph& fg, std::vector<int>& excess,
+                 std::vector<int>& pot, bool& feasible,
+                 int* augmentations, mcf_progress* progress,
+                 frame_recorder* recorder){
+    int flow_value = 0;
+    int augs = 0;
+    if (augmentations != NULL) *augmentations = 0;
+    MCF_STAT_TICKS_BEGIN(t0);
+
+    // With a negative reduced cost somewhere, Dijkstra's distances are
+    // wrong (the heap re-admits settled nodes), and a negative cycle in
+    // the input would let them fall without bound. Cancel whatever
+    // negative cycles the input carries, then one Bellman-Ford pass
+    // makes the potentials valid; for the usual non-negative instances
+    // the check finds nothing and costs one array scan.
+    if (mcf_check_optimality(fg,pot.data()) != -1){
+        mcf_cancel_negative_cycles(fg);
+        std::vector<int> dist0(fg.n,0), pred0(fg.n,-1);
+        bellman_ford(fg,dist0.data(),pred0.data());
+        pot = dist0;
+    }
+
+    // Per-augmentation scratch comes from a bump arena: one reset per
+    // iteration instead of allocating and freeing the arrays every time
+    arena scratch;
+    scratch.ensure(2*(size_t)fg.n*sizeof(int));
+
+    // One heap for the whole solve, cleared by each search
+    d_heap heap;
+    heap.init(fg.n);
+
+    while (true){
+        scratch.reset();
+        int* dist     = scratch.alloc<int>(fg.n);
+        int* pred_arc = scratch.alloc<int>(fg.n);
+        for(int v = 0; v < fg.n; v++){
+            dist[v] = (excess[v] > 0) ? 0 : INF;
+            pred_arc[v] = -1;
+        }
+
+        dijkstra_potentials(fg,pot.data(),dist,pred_arc,heap);
+
+        // Pick the cheapest reachable demand node (reduced distances
+        // rank the demand nodes the same way real distances do, since
+        // all searches start at potential-0 supply nodes)
+        int t = -1;
+        for(int v = 0; v < fg.n; v++){
+            if (excess[v] < 0 && dist[v] < INF && (t == -1 || dist[v] + pot[v] < dist[t] + pot[t])) t = v;
+        }
+        if (t == -1) break;
+
+        // Fold the distances into the potentials; nodes the search did
+        // not reach keep their reduced costs valid via the cap at dist[t]
+        for(int v = 0; v < fg.n; v++)
+            pot[v] += (dist[v] < dist[t]) ? dist[v] : dist[t];
+
+        // Walk back to the supply node feeding this path
+        int s = t;
+        while (pred_arc[s] != -1) s = fg.head[fg.rev[pred_arc[s]]];
+
+        int delta = excess[s];
+        if (-excess[t] < delta) delta = -excess[t];
+        int pushed = augment_path(fg,pred_arc,t,delta);
+        excess[s] -= pushed;
+        excess[t] += pushed;
+        flow_value += pushed;
+        augs++;
+        MCF_STAT_INC(augmentations);
+        MCF_STAT_ADD(flow_pushed,pushed);
+        if (augmentations != NULL) *augmentations = augs;
+        if (progress != NULL) progress->push(mcf_progress::PHASE_AUGMENT,augs,flow_value);
+        if (recorder != NULL) recorder->capture(fg);
+    }
+
+    feasible = true;
+    for(int v = 0; v < fg.n; v++){
+        if (excess[v] != 0) feasible = false;
+    }
+    MCF_STAT_TICKS_END(augment_ticks,t0);
+    return flow_value;
+}
+
+
+// Capacity scaling: work through delta-phases from the largest capacity
+// down to 1. Within a phase only arcs with at least delta residual take
+// part, every augmentation moves exactly delta, and arcs whose reduced
+// cost turned negative when they entered the delta-network are
+// saturated up front so the reduced-cost invariant holds throughout.
+// The final delta = 1 phase is plain SSP, so feasibility and optimality
+// match the unscaled core.
+int mcf_ssp_core_scaling(flat_graph& fg, std::vector<int>& excess,
+                         std::vector<int>& pot, bool& feasible,
+                         int* augmentations){
+    int flow_value = 0;
+    if (augmentations != NULL) *augmentations = 0;
+
+    arena scratch;
+    scratch.ensure(2*(size_t)fg.n*sizeof(int));
+    d_heap heap;
+    heap.init(fg.n);
+
+    int max_cap = 1;
+    for(int a = 0; a < fg.m; a++){
+        if (fg.res[a] > max_cap) max_cap = fg.res[a];
+    }
+    int delta = 1;
+    while (2*delta <= max_cap) delta *= 2;
+
+    for(; delta >= 1; delta /= 2){
+        // Saturate delta-arcs with negative reduced cost; the flow they
+        // carry shows up as excess at their endpoints and gets re-routed
+        // by the phase's augmentations
+        for(int u = 0; u < fg.n; u++){
+            for(int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+                int w = fg.head[a];
+                if (fg.res[a] >= delta && fg.cost[a] + pot[u] - pot[w] < 0){
+                    int r = fg.res[a];
+                    fg.res[fg.rev[a]] += r;
+                    fg.res[a] = 0;
+                    excess[u] -= r;
+                    excess[w] += r;
+                }
+            }
+        }
+
+        while (true){
+            scratch.reset();
+            int* dist     = scratch.alloc<int>(fg.n);
+            int* pred_arc = scratch.alloc<int>(fg.n);
+            bool have_source = false;
+            for(int v = 0; v < fg.n; v++){
+                dist[v] = (excess[v] >= delta) ? 0 : INF;
+                if (excess[v] >= delta) have_source = true;
+                pred_arc[v] = -1;
+            }
+            if (!have_source) break;
+
+            dijkstra_potentials(fg,pot.data(),dist,pred_arc,heap,delta);
+
+            int t = -1;
+            for(int v = 0; v < fg.n; v++){
+                if (excess[v] <= -delta && dist[v] < INF && (t == -1 || dist[v] < dist[t])) t = v;
+            }
+            if (t == -1) break;
+
+            for(int v = 0; v < fg.n; v++)
+                pot[v] += (dist[v] < dist[t]) ? dist[v] : dist[t];
+
+            int s = t;
+            while (pred_arc[s] != -1) s = fg.head[fg.rev[pred_arc[s]]];
+
+            // Every arc on the path has at least delta residual, so the
+            // push is exactly delta
+            int v = t;
+            while (pred_arc[v] != -1){
+                int a = pred_arc[v];
+                fg.res[a] -= delta;
+                fg.res[fg.rev[a]] += delta;
+                v = fg.head[fg.rev[a]];
+            }
+            excess[s] -= delta;
+            excess[t] += delta;
+            flow_value += delta;
+            MCF_STAT_INC(augmentations);
+            MCF_STAT_ADD(flow_pushed,delta);
+            if (augmentations != NULL) (*augmentations)++;
+        }
+    }
+
+    feasible = true;
+    for(int v = 0; v < fg.n; v++){
+        if (excess[v] != 0) feasible = false;
+    }
+    return flow_value;
+}
+
+// Phase-parallel SSP: every phase runs one Dijkstra per thread, each
+// seeded with its share of the remaining supply nodes, and the proposed
+// augmenting paths are committed afterwards on the calling thread. A
+// path whose arcs were drained by an earlier commit of the same phase
+// pushes whatever residual is left (possibly nothing); its supply then
+// simply takes part in the next phase. The committed paths are shortest
+// only for their own seed set, so after each phase a cancellation pass
+// plus one Bellman-Ford refresh restores the reduced-cost invariant the
+// next phase's Dijkstras rely on (the same repair pattern as
+// mcf_state::resolve_edge). The leftovers go to the sequential core.
+int mcf_ssp_core_parallel(flat_graph& fg, std::vector<int>& excess,
+                          std::vector<int>& pot, bool& feasible,
+                          int num_threads, int* augmentations){
+    if (num_threads <= 0) num_threads = (int)std::thread::hardware_concurrency();
+    if (num_threads < 1) num_threads = 1;
+
+    int flow_value = 0;
+    int augs = 0;
+
+    struct proposal {
+        std::vector<int> arcs;   // path arcs, walked from t back to s
+        int s, t;
+        bool found;
+    };
+    std::vector<proposal> props(num_threads);
+    std::vector<std::vector<int>> dist(num_threads), pred_arc(num_threads);
+    std::vector<d_heap> heaps(num_threads);
+    for(int i = 0; i < num_threads; i++) heaps[i].init(fg.n);
+
+    while (num_threads > 1){
+        std::vector<int> supplies;
+        for(int v = 0; v < fg.n; v++){
+            if (excess[v] > 0) supplies.push_back(v);
+        }
+        if ((int)supplies.size() < 2) break;
+
+        int T = num_threads < (int)supplies.size() ? num_threads
+                                                   : (int)supplies.size();
+
+        // The workers only read fg, pot and excess; all writes happen
+        // after the join
+        std::vector<std::thread> pool;
+        for(int i = 0; i < T; i++){
+            pool.emplace_back([&,i,T](){
+                dist[i].assign(fg.n,INF);
+                pred_arc[i].assign(fg.n,-1);
+                for(size_t k = i; k < supplies.size(); k += T)
+                    dist[i][supplies[k]] = 0;
+                dijkstra_potentials(fg,pot.data(),dist[i].data(),
+                                    pred_arc[i].data(),heaps[i]);
+
+                int t = -1;
+                for(int v = 0; v < fg.n; v++){
+                    if (excess[v] < 0 && dist[i][v] < INF &&
+                        (t == -1 || dist[i][v] + pot[v] < dist[i][t] + pot[t]))
+                        t = v;
+                }
+                props[i].found = (t != -1);
+                props[i].arcs.clear();
+                if (t == -1) return;
+                int v = t;
+                while (pred_arc[i][v] != -1){
+                    props[i].arcs.push_back(pred_arc[i][v]);
+                    v = fg.head[fg.rev[pred_arc[i][v]]];
+                }
+                props[i].s = v;
+                props[i].t = t;
+            });
+        }
+        for(std::thread& th : pool) th.join();
+
+        // Conflict detection on shared arcs: each path is re-validated
+        // against the residual capacities as they are after the earlier
+        // commits of this phase
+        int commits = 0;
+        for(int i = 0; i < T; i++){
+            if (!props[i].found) continue;
+            int bottleneck = excess[props[i].s];
+            if (-excess[props[i].t] < bottleneck) bottleneck = -excess[props[i].t];
+            for(int a : props[i].arcs){
+                if (fg.res[a] < bottleneck) bottleneck = fg.res[a];
+            }
+            if (bottleneck <= 0) continue;
+            for(int a : props[i].arcs){
+                fg.res[a] -= bottleneck;
+                fg.res[fg.rev[a]] += bottleneck;
+            }
+            excess[props[i].s] -= bottleneck;
+            excess[props[i].t] += bottleneck;
+            flow_value += bottleneck;
+            commits++;
+            augs++;
+            MCF_STAT_INC(augmentations);
+            MCF_STAT_ADD(flow_pushed,bottleneck);
+        }
+        if (commits == 0) break;
+
+        // The interim flow may admit improving cycles, since only one of
+        // the committed paths was globally shortest; cancel them and
+        // rebuild valid potentials for the next phase
+        mcf_cancel_negative_cycles(fg);
+        std::vector<int> d0(fg.n,0), p0(fg.n,-1);
+        bellman_ford(fg,d0.data(),p0.data());
+        pot = d0;
+    }
+
+    // Remaining excess — a single leftover supply, conflict-starved
+    // phases or plain infeasibility — is finished by the sequential
+    // core, which also settles feasible
+    int tail_augs = 0;
+    flow_value += mcf_ssp_core(fg,excess,pot,feasible,&tail_augs);
+    if (augmentations != NULL) *augmentations = augs + tail_augs;
+    return flow_value;
+}
+
+// Cancellation core: find negative cycles in the residual graph with
+// the SPFA detector and push flow around them until none remain. Each
+// search after the first is seeded with the nodes of the cycle just
+// canceled, since new negative cycles mostly appear where the residual
+// graph changed; only when the seeded search comes up empty is a full
+// restart needed to prove optimality.
+void mcf_cancel_negative_cycles(flat_graph& fg, int* cancellations,
+                                mcf_progress* progress,
+                                frame_recorder* recorder){
+    int cancels = 0;
+    if (cancellations != NULL) *cancellations = 0;
+    MCF_STAT_TICKS_BEGIN(t0);
+    std::vector<int> seeds;
+    std::vector<int> cycle_arcs;
+    arena scratch;
+
+    while (true){
+        if (!find_negative_cycle(fg,seeds,cycle_arcs,scratch)){
+            if (seeds.empty()) break;
+            seeds.clear();
+            continue;
+        }
+
+        int bottleneck = INF;
+        for(int a : cycle_arcs){
+            if (fg.res[a] < bottleneck) bottleneck = fg.res[a];
+        }
+        seeds.clear();
+        for(int a : cycle_arcs){
+            fg.res[a] -= bottleneck;
+            fg.res[fg.rev[a]] += bottleneck;
+            seeds.push_back(fg.head[a]);
+        }
+        cancels++;
+        MCF_STAT_INC(cancellations);
+        MCF_STAT_ADD(flow_pushed,bottleneck);
+        if (cancellations != NULL) *cancellations = cancels;
+        if (progress != NULL) progress->push(mcf_progress::PHASE_CANCEL,cancels,0);
+        if (recorder != NULL) recorder->capture(fg);
+    }
+    MCF_STAT_TICKS_END(cancel_ticks,t0);
+}
+
+// Min-mean variant: each iteration cancels a minimum mean cycle from
+// Karp's algorithm, which is what makes the overall method strongly
+// polynomial. The cost guard is a safety net against canceling a
+// non-improving cycle.
+void mcf_cancel_min_mean_cycles(flat_graph& fg, int* cancellations){
+    if (cancellations != NULL) *cancellations = 0;
+    std::vector<int> cycle_arcs;
+
+    while (find_min_mean_cycle(fg,cycle_arcs)){
+        int total = 0;
+        int bottleneck = INF;
+        for(int a : cycle_arcs){
+            total += fg.cost[a];
+            if (fg.res[a] < bottleneck) bottleneck = fg.res[a];
+        }
+        if (total >= 0 || bottleneck <= 0) break;
+
+        for(int a : cycle_arcs){
+            fg.res[a] -= bottleneck;
+            fg.res[fg.rev[a]] += bottleneck;
+        }
+        MCF_STAT_INC(cancellations);
+        MCF_STAT_ADD(flow_pushed,bottleneck);
+        if (cancellations != NULL) (*cancellations)++;
+    }
+}
+
+mcf_result mcf_solve_ssp(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                         const edge_map<int>& Gcap, edge_map<int>& Gflow,
+                         bool capacity_scaling){
+    mcf_result result = { false, 0, 0 };
+#ifdef MCF_STATS
+    g_mcf_stats.reset();
+#endif
+
+    flat_graph fg;
+    fg.build(G,Gcost,Gcap);
+    std::vector<int> excess(fg.balance);
+    std::vector<int> pot(fg.n,0);
+    result.flow_value = capacity_scaling
+        ? mcf_ssp_core_scaling(fg,excess,pot,result.feasible)
+        : mcf_ssp_core(fg,excess,pot,result.feasible);
+    if (capacity_scaling && result.feasible){
+        // Scaling phases also re-route internally stranded flow, so the
+        // routed supply is read off the balances instead
+        result.flow_value = 0;
+        for(int v = 0; v < fg.n; v++){
+            if (fg.balance[v] > 0) result.flow_value += fg.balance[v];
+        }
+    }
+    fg.sync_flow(Gcap,Gflow);
+
+    result.total_cost = flow_cost(G,Gcost,Gflow);
+#ifdef MCF_STATS
+    g_mcf_stats.dump_json(stderr);
+#endif
+    return result;
+}
+
+mcf_result mcf_solve_cycle_canceling(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                                     const edge_map<int>& Gcap, edge_map<int>& Gflow,
+                                     bool min_mean){
+    mcf_result result = { false, 0, 0 };
+#ifdef MCF_STATS
+    g_mcf_stats.reset();
+#endif
+
+    flat_graph fg;
+    fg.build(G,Gcost,Gcap);
+
+    // Step 1: establish a feasible flow with the costs blanked out.
+    // Routing with the real costs would already hand step 2 a
+    // minimum-cost flow and leave the cancellation loop nothing to do;
+    // cost-blind routing is what makes this a cycle canceling solve.
+    std::vector<int> real_cost(fg.cost);
+    for(int a = 0; a < fg.m; a++) fg.cost[a] = 0;
+    std::vector<int> excess(fg.balance);
+    std::vector<int> pot(fg.n,0);
+    result.flow_value = mcf_ssp_core(fg,excess,pot,result.feasible);
+
+    // Step 2: the real costs return and the cancellation loop drives
+    // the feasible flow down to the optimum
+    fg.cost = real_cost;
+    if (result.feasible){
+        if (min_mean) mcf_cancel_min_mean_cycles(fg);
+        else          mcf_cancel_negative_cycles(fg);
+    }
+    fg.sync_flow(Gcap,Gflow);
+
+    result.total_cost = flow_cost(G,Gcost,Gflow);
+#ifdef MCF_STATS
+    g_mcf_stats.dump_json(stderr);
+#endif
+    return result;
+}
+
+mcf_result mcf_state::solve(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                            const edge_map<int>& Gcap, edge_map<int>& Gflow){
+    mcf_result result = { false, 0, 0 };
+
+    fg.build(G,Gcost,Gcap);
+    std::vector<int> excess(fg.balance);
+    pot.assign(fg.n,0);
+    result.flow_value = mcf_ssp_core(fg,excess,pot,result.feasible);
+    fg.sync_flow(Gcap,Gflow);
+
+    result.total_cost = flow_cost(G,Gcost,Gflow);
+    solved = true;
+    return result;
+}
+
+mcf_result mcf_state::resolve_edge(GRAPH<int,int>& G, edge e, const edge_map<int>& Gcost,
+                                   const edge_map<int>& Gcap, edge_map<int>& Gflow){
+    if (!solved) return solve(G,Gcost,Gcap,Gflow);
+
+    mcf_result result = { true, 0, 0 };
+
+    int a = fg.arc_of[index(e)];
+    int b = fg.rev[a];
+    int w = fg.head[a];         // target of e
+    int u = fg.head[b];         // source of e
+
+    // res[b] is exactly the flow currently on e, so the old capacity is
+    // not needed to apply the new one
+    int flow = fg.res[b];
+    fg.cost[a] =  Gcost[e];
+    fg.cost[b] = -Gcost[e];
+
+    if (Gcap[e] < flow){
+        // Capacity dropped below the current flow: take the surplus off
+        // the edge, which strands flow at its endpoints ...
+        int surplus = flow - Gcap[e];
+        fg.res[a] = 0;
+        fg.res[b] = Gcap[e];
+        std::vector<int> excess(fg.n,0);
+        excess[u] =  surplus;
+        excess[w] = -surplus;
+        // ... and re-route just that surplus with warm potentials
+        bool repaired = false;
+        mcf_ssp_core(fg,excess,pot,repaired);
+        result.feasible = repaired;
+    }
+    else {
+        fg.res[a] = Gcap[e] - flow;
+    }
+
+    // A cost change (or a capacity increase opening a residual arc) can
+    // create a negative reduced cost on this one edge; only then is a
+    // cancellation pass needed
+    if ((fg.res[a] > 0 && fg.cost[a] + pot[u] - pot[w] < 0) ||
+        (fg.res[b] > 0 && fg.cost[b] + pot[w] - pot[u] < 0)){
+        mcf_cancel_negative_cycles(fg);
+        // Cancellation moves flow without touching the potentials, so
+        // refresh them with one Bellman-Ford pass over the new residual
+        // graph (all reduced costs are then non-negative again)
+        std::vector<int> dist(fg.n,0);
+        std::vector<int> pred_arc(fg.n,-1);
+        bellman_ford(fg,dist.data(),pred_arc.data());
+        pot = dist;
+    }
+
+    fg.sync_flow(Gcap,Gflow);
+    result.total_cost = flow_cost(G,Gcost,Gflow);
+    if (result.feasible){
+        for(int v = 0; v < fg.n; v++){
+            if (fg.balance[v] > 0) result.flow_value += fg.balance[v];
+        }
+    }
+    return result;
+}
@@ -0,0 +1,161 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Headless Solver Engine (ohne GraphWin)
+ *
+ * ************************/
+
+#ifndef MIN_COST_FLOW_H
+#define MIN_COST_FLOW_H
+
+#include <LEDA/graph/graph.h>
+
+#include <atomic>
+#include <vector>
+
+#include "Flat_Graph.h"
+
+using namespace leda;
+
+// Result of a headless solve. No GraphWin calls are made anywhere in the
+// engine, so the solvers can run in batch on machines without X11.
+struct mcf_result {
+    bool feasible;      // true if all supplies could be routed
+    int  total_cost;    // sum of Gcost[e] * flow[e] over all edges
+    int  flow_value;    // total supply routed from supply to demand nodes
+};
+
+// Solve the min cost flow problem on G with the Successive Shortest Path
+// algorithm. Node balances are taken from G.node_data()[v] (supply > 0,
+// demand < 0). The resulting flow is written into Gflow. With
+// capacity_scaling the delta-phase variant is used, which pays off once
+// capacities go well beyond the demo's rand_int(10,20) range.
+mcf_result mcf_solve_ssp(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                         const edge_map<int>& Gcap, edge_map<int>& Gflow,
+                         bool capacity_scaling = false);
+
+// Solve the min cost flow problem on G with the Cycle Canceling algorithm:
+// first establish a feasible flow, then cancel negative cycles in the
+// residual graph until none remain. With min_mean each cancellation
+// picks a minimum mean cycle (Karp), which bounds the number of
+// cancellations polynomially even on adversarial instances where
+// arbitrary negative cycles only improve by tiny amounts.
+mcf_result mcf_solve_cycle_canceling(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                                     const edge_map<int>& Gcap, edge_map<int>& Gflow,
+                                     bool min_mean = false);
+
+// Lock-free single-producer/single-consumer progress stream. The solver
+// thread pushes a snapshot per iteration (dropped when the ring is
+// full, the consumer only wants the latest state anyway) and the UI
+// thread drains at frame rate without ever blocking the solve.
+struct mcf_progress {
+    enum { PHASE_AUGMENT = 1, PHASE_CANCEL = 2, PHASE_DONE = 3 };
+
+    struct event {
+        int phase;
+        int iterations;   // augmentations or cancellations so far
+        int flow_value;   // flow routed so far (augment phase)
+    };
+
+    static const int RING = 1024;
+    event ring[RING];
+    std::atomic<int> head;   // next write
+    std::atomic<int> tail;   // next read
+
+    mcf_progress() : head(0), tail(0) {}
+
+    void push(int phase, int iterations, int flow_value){
+        int h = head.load(std::memory_order_relaxed);
+        int t = tail.load(std::memory_order_acquire);
+        if (h - t >= RING) return;
+        ring[h % RING].phase = phase;
+        ring[h % RING].iterations = iterations;
+        ring[h % RING].flow_value = flow_value;
+        head.store(h+1,std::memory_order_release);
+    }
+
+    bool pop(event& e){
+        int t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        e = ring[t % RING];
+        tail.store(t+1,std::memory_order_release);
+        return true;
+    }
+};
+
+struct frame_recorder;
+
+// Flat-level solver entry points for headless batch runners that build
+// and own their flat_graphs directly (no LEDA graph involved on the hot
+// path). excess and pot are in/out; the flow ends up in fg.res.
+// The optional counters report how many augmentations/cancellations the
+// run needed, and progress (if given) receives one event per iteration
+// for a concurrently watching UI. A recorder (if given) captures one
+// animation frame per iteration for later replay.
+int mcf_ssp_core(flat_graph& fg, std::vector<int>& excess,
+                 std::vector<int>& pot, bool& feasible,
+                 int* augmentations = NULL, mcf_progress* progress = NULL,
+                 frame_recorder* recorder = NULL);
+void mcf_cancel_negative_cycles(flat_graph& fg, int* cancellations = NULL,
+                                mcf_progress* progress = NULL,
+                                frame_recorder* recorder = NULL);
+void mcf_cancel_min_mean_cycles(flat_graph& fg, int* cancellations = NULL);
+
+// Phase-parallel SSP for instances with many independent supplies.
+// Each phase partitions the remaining supply nodes over the threads,
+// every thread grows its own shortest-path tree from its share and
+// proposes one augmenting path; the proposals are committed on the
+// calling thread, re-validating residual capacities so paths that
+// collided on shared arcs push less or wait for the next phase. The
+// committed paths are only locally shortest, so after the balances are
+// routed a negative-cycle pass restores the exact optimum. num_threads
+// 0 uses the hardware thread count; with 1 the behaviour degenerates
+// to the plain core.
+int mcf_ssp_core_parallel(flat_graph& fg, std::vector<int>& excess,
+                          std::vector<int>& pot, bool& feasible,
+                          int num_threads = 0, int* augmentations = NULL);
+
+// Capacity scaling variant of the SSP core: delta-phases halving from
+// the largest capacity, each path computation pushing delta units at
+// once. On instances with large capacities this replaces the
+// pseudo-polynomial augmentation count of plain SSP with O(E log U)
+// path computations.
+int mcf_ssp_core_scaling(flat_graph& fg, std::vector<int>& excess,
+                         std::vector<int>& pot, bool& feasible,
+                         int* augmentations = NULL);
+
+// Cost of the flow currently encoded in fg.res (the reverse residual of
+// a forward arc is exactly its flow).
+int mcf_flat_cost(const flat_graph& fg);
+
+// Complementary slackness check: every residual arc must have
+// non-negative reduced cost cost[a] + pot[tail] - pot[head] (the same
+// sign convention as dijkstra_potentials). Runs as a
+// branch-free block pass over the contiguous arrays, so the compiler
+// can vectorize the common all-good case; only a block containing a
+// violation is rescanned. Returns the first violating arc, or -1 if the
+// flow is provably optimal for the given potentials.
+int mcf_check_optimality(const flat_graph& fg, const int* pot);
+
+// Warm-start solver state for what-if analysis. solve() runs a cold SSP
+// solve and keeps the flow and node potentials alive; after a single
+// edge's cost or capacity changed (e.g. through a slider handler),
+// resolve_edge() repairs feasibility and optimality only around that
+// edge instead of recomputing everything from scratch.
+struct mcf_state {
+    flat_graph fg;
+    std::vector<int> pot;   // node potentials of the last solve
+    bool solved;
+
+    mcf_state() : solved(false) {}
+
+    mcf_result solve(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                     const edge_map<int>& Gcap, edge_map<int>& Gflow);
+
+    mcf_result resolve_edge(GRAPH<int,int>& G, edge e, const edge_map<int>& Gcost,
+                            const edge_map<int>& Gcap, edge_map<int>& Gflow);
+};
+
+#endif
@@ -0,0 +1,318 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Netzwerk-Simplex als dritter Loesungsalgorithmus
+ *
+ * ************************/
+
+#include "Network_Simplex.h"
+
+#include <vector>
+
+// Simplex working state. Arcs 0..n_real-1 are the forward arcs of the
+// snapshot in order; behind them sits one artificial arc per node
+// connecting it to the root N-1. Costs and potentials are long long so
+// the artificial BIG cost cannot overflow any reduced cost.
+struct simplex_state {
+    int N;                          // nodes including the root
+    int M;                          // arcs including the artificial ones
+    int n_real;
+
+    std::vector<int> tail, head;
+    std::vector<int> cap, flow;
+    std::vector<long long> cost;
+
+    std::vector<char> in_tree;
+    std::vector<int> parent, parc;  // tree parent and the arc to it
+    std::vector<int> depth;
+    std::vector<long long> pot;
+    std::vector<std::vector<int> > tree_at;  // tree arcs per node
+};
+
+// Recompute parent/depth/potential from the tree arc lists. One DFS
+// from the root; tree arcs satisfy reduced cost zero, which fixes the
+// potentials along the way.
+static void rebuild_tree(simplex_state& S){
+    int root = S.N-1;
+    std::vector<char> seen(S.N,0);
+    std::vector<int> stack;
+    S.parent[root] = -1;
+    S.parc[root] = -1;
+    S.depth[root] = 0;
+    S.pot[root] = 0;
+    seen[root] = 1;
+    stack.push_back(root);
+    while (!stack.empty()){
+        int u = stack.back();
+        stack.pop_back();
+        for (int a : S.tree_at[u]){
+            int w = (S.tail[a] == u) ? S.head[a] : S.tail[a];
+            if (seen[w]) continue;
+            seen[w] = 1;
+            S.parent[w] = u;
+            S.parc[w] = a;
+            S.depth[w] = S.depth[u] + 1;
+            S.pot[w] = (S.tail[a] == u) ? S.pot[u] + S.cost[a]
+                                        : S.pot[u] - S.cost[a];
+            stack.push_back(w);
+        }
+    }
+}
+
+// Block search for the entering arc: scan a wandering block of the arc
+// list and take its best bound violation; move on block by block until
+// one violating arc is found or the whole list came up clean. In bland
+// mode the smallest-index violating arc enters instead — together with
+// the smallest-index leaving rule in pivot() this is Bland's rule,
+// which provably cannot cycle.
+static int find_entering(simplex_state& S, int& scan_start, int block,
+                         bool bland){
+    if (bland){
+        for (int a = 0; a < S.M; a++){
+            if (S.in_tree[a] || S.cap[a] <= 0) continue;
+            long long rc = S.cost[a] + S.pot[S.tail[a]] - S.pot[S.head[a]];
+            if ((S.flow[a] == 0 && rc < 0) ||
+                (S.flow[a] == S.cap[a] && rc > 0)) return a;
+        }
+        return -1;
+    }
+
+    int scanned = 0;
+    while (scanned < S.M){
+        int best = -1;
+        long long best_v = 0;
+        for (int i = 0; i < block && scanned < S.M; i++, scanned++){
+            int a = scan_start;
+            scan_start = (scan_start+1 == S.M) ? 0 : scan_start+1;
+            if (S.in_tree[a] || S.cap[a] <= 0) continue;
+            long long rc = S.cost[a] + S.pot[S.tail[a]] - S.pot[S.head[a]];
+            long long v = 0;
+            if (S.flow[a] == 0 && rc < 0) v = -rc;
+            else if (S.flow[a] == S.cap[a] && rc > 0) v = rc;
+            if (v > best_v){ best_v = v; best = a; }
+        }
+        if (best != -1) return best;
+    }
+    return -1;
+}
+
+// One arc of the pivot cycle: traversed with the push (+1) or against
+// it (-1)
+struct cycle_arc {
+    int a;
+    int sign;
+};
+
+// Bring the entering arc into the basis: push around the cycle it
+// closes with the tree until some arc hits a bound; that arc leaves. If
+// the entering arc itself is the blocking one it just flips bounds and
+// the tree stays as it is. Returns the pushed amount, so the caller can
+// see degenerate pivots. In bland mode the smallest-index blocking arc
+// leaves (see find_entering).
+static int pivot(simplex_state& S, int a, bool bland){
+    bool increasing = (S.flow[a] == 0);
+
+    // Push direction around the cycle: along the entering arc if it
+    // rises from its lower bound, against it if it falls from its upper
+    int from = increasing ? S.head[a] : S.tail[a];
+    int to   = increasing ? S.tail[a] : S.head[a];
+
+    // Tree path from `from` to `to` through the lowest common ancestor.
+    // Climbing x -> parent travels with the tree arc iff x is its tail;
+    // on the descending half the travel direction flips.
+    std::vector<cycle_arc> cycle;
+    std::vector<cycle_arc> down;
+    cycle.push_back({ a, increasing ? 1 : -1 });
+
+    int x = from, y = to;
+    while (S.depth[x] > S.depth[y]){
+        int t = S.parc[x];
+        cycle.push_back({ t, (S.tail[t] == x) ? 1 : -1 });
+        x = S.parent[x];
+    }
+    while (S.depth[y] > S.depth[x]){
+        int t = S.parc[y];
+        down.push_back({ t, (S.tail[t] == y) ? -1 : 1 });
+        y = S.parent[y];
+    }
+    while (x != y){
+        int t = S.parc[x];
+        cycle.push_back({ t, (S.tail[t] == x) ? 1 : -1 });
+        x = S.parent[x];
+        t = S.parc[y];
+        down.push_back({ t, (S.tail[t] == y) ? -1 : 1 });
+        y = S.parent[y];
+    }
+    for (size_t i = down.size(); i > 0; i--) cycle.push_back(down[i-1]);
+
+    // Blocking quantity per arc: headroom with the push, flow against it
+    int delta = -1;
+    for (const cycle_arc& c : cycle){
+        int room = (c.sign > 0) ? S.cap[c.a] - S.flow[c.a] : S.flow[c.a];
+        if (delta < 0 || room < delta) delta = room;
+    }
+
+    int leaving = -1;
+    if (bland){
+        // Smallest index among the blocking arcs, Bland's leaving rule
+        for (const cycle_arc& c : cycle){
+            int room = (c.sign > 0) ? S.cap[c.a] - S.flow[c.a] : S.flow[c.a];
+            if (room == delta && (leaving == -1 || c.a < leaving)) leaving = c.a;
+        }
+    }
+    else {
+        // Prefer the entering arc as the leaving one on ties: a bound
+        // flip keeps the tree and costs no rebuild
+        const cycle_arc& e = cycle[0];
+        int room = (e.sign > 0) ? S.cap[e.a] - S.flow[e.a] : S.flow[e.a];
+        if (room == delta) leaving = e.a;
+        for (const cycle_arc& c : cycle){
+            if (leaving != -1) break;
+            room = (c.sign > 0) ? S.cap[c.a] - S.flow[c.a] : S.flow[c.a];
+            if (room == delta) leaving = c.a;
+        }
+    }
+
+    for (const cycle_arc& c : cycle) S.flow[c.a] += c.sign * delta;
+
+    if (leaving == a) return delta;
+
+    // Swap basis membership and re-derive the tree arrays
+    S.in_tree[leaving] = 0;
+    int ends[2] = { S.tail[leaving], S.head[leaving] };
+    for (int k = 0; k < 2; k++){
+        std::vector<int>& lst = S.tree_at[ends[k]];
+        for (size_t i = 0; i < lst.size(); i++){
+            if (lst[i] == leaving){ lst[i] = lst.back(); lst.pop_back(); break; }
+        }
+    }
+    S.in_tree[a] = 1;
+    S.tree_at[S.tail[a]].push_back(a);
+    S.tree_at[S.head[a]].push_back(a);
+    rebuild_tree(S);
+    return delta;
+}
+
+int mcf_network_simplex(flat_graph& fg, bool& feasible, int* pivots){
+    int n = fg.n;
+    simplex_state S;
+    S.N = n+1;
+    int root = n;
+
+    // Real arcs: the snapshot's forward arcs in order, full capacity
+    // regardless of any flow already encoded in fg.res
+    std::vector<int> fg_arc;
+    long long max_cost = 1;
+    for (int u = 0; u < n; u++){
+        for (int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+            if (!fg.forward[a]) continue;
+            S.tail.push_back(u);
+            S.head.push_back(fg.head[a]);
+            S.cap.push_back(fg.res[a] + fg.res[fg.rev[a]]);
+            S.cost.push_back(fg.cost[a]);
+            S.flow.push_back(0);
+            fg_arc.push_back(a);
+            long long c = fg.cost[a];
+            if (c < 0) c = -c;
+            if (c > max_cost) max_cost = c;
+        }
+    }
+    S.n_real = (int)S.tail.size();
+
+    // Artificial arcs: one per node, expensive enough that the optimum
+    // only uses them when the instance is infeasible. Oriented with the
+    // node's balance so the initial basis flow is non-negative.
+    long long big = (max_cost + 1) * (long long)S.N;
+    int total_pos = 0, total_neg = 0;
+    for (int v = 0; v < n; v++){
+        if (fg.balance[v] > 0) total_pos += fg.balance[v];
+        else                   total_neg -= fg.balance[v];
+    }
+    int art_cap = (total_pos > total_neg) ? total_pos : total_neg;
+    if (art_cap < 1) art_cap = 1;
+
+    S.tree_at.assign(S.N,std::vector<int>());
+    for (int v = 0; v < n; v++){
+        int b = fg.balance[v];
+        int a = (int)S.tail.size();
+        if (b >= 0){
+            S.tail.push_back(v);
+            S.head.push_back(root);
+            S.flow.push_back(b);
+        }
+        else {
+            S.tail.push_back(root);
+            S.head.push_back(v);
+            S.flow.push_back(-b);
+        }
+        S.cap.push_back(art_cap);
+        S.cost.push_back(big);
+        S.tree_at[v].push_back(a);
+        S.tree_at[root].push_back(a);
+    }
+    S.M = (int)S.tail.size();
+
+    S.in_tree.assign(S.M,0);
+    for (int a = S.n_real; a < S.M; a++) S.in_tree[a] = 1;
+    S.parent.assign(S.N,-1);
+    S.parc.assign(S.N,-1);
+    S.depth.assign(S.N,0);
+    S.pot.assign(S.N,0);
+    rebuild_tree(S);
+
+    // Block size ~ sqrt(M), the customary balance between pivot quality
+    // and scan cost
+    int block = 64;
+    while ((long long)block*block < S.M) block *= 2;
+
+    // Block search with first-blocking leaving arcs is fast but not
+    // cycling-proof: degenerate pivots move no flow yet still swap
+    // basis arcs and could revisit a basis forever. After M degenerate
+    // pivots in a row the rules switch to Bland's smallest-index rule,
+    // which cannot cycle, and switch back once a pivot moves flow.
+    int scan_start = 0;
+    int count = 0;
+    int degenerate = 0;
+    bool bland = false;
+    int a;
+    while ((a = find_entering(S,scan_start,block,bland)) != -1){
+        int delta = pivot(S,a,bland);
+        count++;
+        if (delta > 0){ degenerate = 0; bland = false; }
+        else if (++degenerate > S.M) bland = true;
+    }
+    if (pivots != NULL) *pivots = count;
+
+    // Any flow left on an artificial arc is supply the network cannot
+    // absorb
+    feasible = true;
+    int stranded = 0;
+    for (int v = 0; v < n; v++){
+        int f = S.flow[S.n_real + v];
+        if (f != 0) feasible = false;
+        if (fg.balance[v] > 0) stranded += f;
+    }
+
+    // Write the basis flow back into the residual representation
+    for (int i = 0; i < S.n_real; i++){
+        int a2 = fg_arc[i];
+        fg.res[a2] = S.cap[i] - S.flow[i];
+        fg.res[fg.rev[a2]] = S.flow[i];
+    }
+
+    return total_pos - stranded;
+}
+
+mcf_result mcf_solve_network_simplex(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                                     const edge_map<int>& Gcap, edge_map<int>& Gflow){
+    mcf_result result = { false, 0, 0 };
+
+    flat_graph fg;
+    fg.build(G,Gcost,Gcap);
+    result.flow_value = mcf_network_simplex(fg,result.feasible);
+    fg.sync_flow(Gcap,Gflow);
+    result.total_cost = mcf_flat_cost(fg);
+    return result;
+}
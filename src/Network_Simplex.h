@@ -0,0 +1,33 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Netzwerk-Simplex als dritter Loesungsalgorithmus
+ *
+ * ************************/
+
+#ifndef NETWORK_SIMPLEX_H
+#define NETWORK_SIMPLEX_H
+
+#include "Min_Cost_Flow.h"
+
+// Primal network simplex on the flat snapshot. A spanning tree rooted
+// in an artificial node carries the basis; non-tree arcs sit at one of
+// their bounds and the entering arc is picked by block search over the
+// arc list (best violation inside a wandering block, the usual
+// compromise between Dantzig's rule and round robin). The initial basis
+// connects every node to the root through an expensive artificial arc,
+// so feasibility falls out of the optimum: the flow is feasible exactly
+// when no artificial arc carries flow at the end.
+//
+// Works on the forward arcs of fg and leaves the result in fg.res like
+// the other cores, so sync_flow and mcf_flat_cost apply unchanged.
+// Returns the routed flow value.
+int mcf_network_simplex(flat_graph& fg, bool& feasible, int* pivots = NULL);
+
+// Graph-level wrapper in the style of the other two solvers.
+mcf_result mcf_solve_network_simplex(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                                     const edge_map<int>& Gcap, edge_map<int>& Gflow);
+
+#endif
@@ -0,0 +1,75 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Headless Netzwerk-Simplex Programm
+ *
+ * ************************/
+
+#include "Dimacs.h"
+#include "Edit_Journal.h"
+#include "Graph_Snapshot.h"
+#include "Network_Simplex.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+static bool has_suffix(const char* s, const char* suffix){
+    size_t ls = strlen(s), lx = strlen(suffix);
+    return ls >= lx && strcmp(s+ls-lx,suffix) == 0;
+}
+
+// Solve one instance with the network simplex and report the result.
+// Accepts the same inputs as the visual programs: DIMACS .min files or
+// binary snapshots, optionally with a recorded edit journal applied on
+// top, so an analyst session replays in batch. No window is opened.
+int main(int argc, char* argv[]){
+    if (argc < 2){
+        fprintf(stderr,"usage: %s <instance.min | snapshot> [journal]\n",argv[0]);
+        return 1;
+    }
+
+    edit_journal journal;
+    bool with_journal = false;
+    if (argc > 2){
+        if (!journal.load(argv[2])){
+            fprintf(stderr,"cannot read %s\n",argv[2]);
+            return 1;
+        }
+        with_journal = true;
+    }
+
+    flat_graph fg;
+    if (has_suffix(argv[1],".min")){
+        raw_instance inst;
+        if (!load_dimacs(argv[1],inst)){
+            fprintf(stderr,"cannot read %s\n",argv[1]);
+            return 1;
+        }
+        if (with_journal) journal.apply(inst);
+        fg.build_raw(inst.n,inst.src,inst.dst,inst.cost,inst.cap,inst.balance);
+    }
+    else {
+        GRAPH<int,int> G;
+        edge_map<int> Gcost(G), Gcap(G);
+        if (!load_snapshot(argv[1],G,Gcost,Gcap)){
+            fprintf(stderr,"cannot read %s\n",argv[1]);
+            return 1;
+        }
+        fg.build(G,Gcost,Gcap);
+        if (with_journal) journal.apply(fg);
+    }
+
+    bool feasible = false;
+    int pivots = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    int flow_value = mcf_network_simplex(fg,feasible,&pivots);
+    double ms = std::chrono::duration<double,std::milli>(
+        std::chrono::steady_clock::now() - t0).count();
+
+    printf("nodes=%d edges=%d feasible=%d cost=%d flow=%d pivots=%d time_ms=%.3f\n",
+           fg.n,fg.m/2,feasible?1:0,mcf_flat_cost(fg),flow_value,pivots,ms);
+    return feasible ? 0 : 2;
+}
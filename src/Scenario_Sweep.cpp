@@ -0,0 +1,57 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Paralleler Szenario-Lauf ueber viele Balance-Vektoren
+ *
+ * ************************/
+
+#include "Scenario_Sweep.h"
+
+#include <atomic>
+#include <thread>
+
+std::vector<mcf_result> sweep_scenarios(GRAPH<int,int>& G,
+                                        const edge_map<int>& Gcost,
+                                        const edge_map<int>& Gcap,
+                                        const std::vector<std::vector<int>>& scenarios,
+                                        int num_threads){
+    // One immutable snapshot shared by all workers
+    flat_graph base;
+    base.build(G,Gcost,Gcap);
+
+    std::vector<mcf_result> results(scenarios.size(),mcf_result{false,0,0});
+
+    if (num_threads <= 0) num_threads = (int)std::thread::hardware_concurrency();
+    if (num_threads < 1) num_threads = 1;
+    if ((size_t)num_threads > scenarios.size()) num_threads = (int)scenarios.size();
+    if (num_threads < 1) return results;
+
+    // Workers pull the next scenario index from a shared counter, so
+    // slow scenarios do not stall a static partition
+    std::atomic<size_t> next(0);
+
+    auto worker = [&](){
+        // Thread-local flow state: only res changes during a solve, so
+        // restoring it per scenario is one vector assignment
+        flat_graph fg = base;
+        size_t i;
+        while ((i = next.fetch_add(1)) < scenarios.size()){
+            fg.res = base.res;
+            std::vector<int> excess(scenarios[i]);
+            std::vector<int> pot(fg.n,0);
+
+            mcf_result r = { false, 0, 0 };
+            r.flow_value = mcf_ssp_core(fg,excess,pot,r.feasible);
+            r.total_cost = mcf_flat_cost(fg);
+            results[i] = r;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < num_threads; t++) threads.push_back(std::thread(worker));
+    for(std::thread& t : threads) t.join();
+
+    return results;
+}
@@ -0,0 +1,31 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Paralleler Szenario-Lauf ueber viele Balance-Vektoren
+ *
+ * ************************/
+
+#ifndef SCENARIO_SWEEP_H
+#define SCENARIO_SWEEP_H
+
+#include "Min_Cost_Flow.h"
+
+#include <vector>
+
+// Evaluate many supply/demand scenarios against one fixed network. The
+// graph with its cost/cap maps is snapshotted once into an immutable
+// flat_graph; worker threads each keep a thread-local copy of the flow
+// state and pull scenarios from a shared counter, so the cores that
+// currently idle during nightly sweeps all get work.
+//
+// scenarios[i] is a balance vector indexed like the flat_graph nodes
+// (i.e. in forall_nodes order). Results come back in the same order.
+std::vector<mcf_result> sweep_scenarios(GRAPH<int,int>& G,
+                                        const edge_map<int>& Gcost,
+                                        const edge_map<int>& Gcap,
+                                        const std::vector<std::vector<int>>& scenarios,
+                                        int num_threads = 0);
+
+#endif
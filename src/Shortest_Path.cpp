@@ -0,0 +1,60 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Kuerzeste-Wege-Routinen auf der flachen Graphdarstellung
+ *
+ * ************************/
+
+#include "Shortest_Path.h"
+#include "Mcf_Stats.h"
+
+void bellman_ford(const flat_graph& fg, int* dist, int* pred_arc){
+    bool changed = true;
+    for(int round = 0; round < fg.n && changed; round++){
+        changed = false;
+        for(int u = 0; u < fg.n; u++){
+            if (dist[u] >= SP_INF) continue;
+            for(int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+                if (fg.res[a] <= 0) continue;
+                int w = fg.head[a];
+                if (dist[u] + fg.cost[a] < dist[w]){
+                    dist[w] = dist[u] + fg.cost[a];
+                    pred_arc[w] = a;
+                    changed = true;
+                    MCF_STAT_INC(relaxations);
+                }
+            }
+        }
+    }
+}
+
+void dijkstra_potentials(const flat_graph& fg, const int* pot,
+                         int* dist, int* pred_arc, d_heap& heap,
+                         int min_res){
+    MCF_STAT_INC(sp_calls);
+    heap.clear();
+    for(int v = 0; v < fg.n; v++){
+        if (dist[v] == 0) heap.insert_or_decrease(v,0);
+    }
+
+    while (!heap.empty()){
+        int u = heap.extract_min();
+        int d = dist[u];
+        MCF_STAT_INC(nodes_scanned);
+
+        for(int a = fg.first_out[u]; a < fg.first_out[u+1]; a++){
+            if (fg.res[a] < min_res) continue;
+            int w = fg.head[a];
+            int rc = fg.cost[a] + pot[u] - pot[w];
+            if (d + rc < dist[w]){
+                dist[w] = d + rc;
+                pred_arc[w] = a;
+                heap.insert_or_decrease(w,dist[w]);
+                MCF_STAT_INC(relaxations);
+                MCF_STAT_INC(heap_inserts);
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Kuerzeste-Wege-Routinen auf der flachen Graphdarstellung
+ *
+ * ************************/
+
+#ifndef SHORTEST_PATH_H
+#define SHORTEST_PATH_H
+
+#include "D_Heap.h"
+#include "Flat_Graph.h"
+
+// Shared shortest-path engine for both solver cores. All routines search
+// the residual graph, i.e. only arcs with fg.res[a] > 0 are considered,
+// and report for every reached node the arc the path enters it on.
+//
+// Callers seed the search by setting dist[v] = 0 for every start node
+// (everything else INF); this supports the multi-supply searches the
+// SSP core needs without a super source. The arrays are raw pointers of
+// length fg.n so the callers can hand out arena scratch.
+
+const int SP_INF = 0x3fffffff;
+
+// Plain Bellman-Ford. Handles negative arc costs; used to bootstrap node
+// potentials and kept around for verification.
+void bellman_ford(const flat_graph& fg, int* dist, int* pred_arc);
+
+// Dijkstra over reduced costs cost[a] + pot[tail] - pot[head]. With valid
+// potentials every reduced cost is non-negative, so each augmentation
+// costs O(E log V) instead of Bellman-Ford's O(VE). The distances
+// returned are reduced distances; real distances are dist[v] + pot[v] -
+// pot[start]. The caller owns the heap: init it once per solve and hand
+// it back in for every augmentation, the search clears it on entry.
+// min_res restricts the search to arcs with at least that much residual
+// capacity (the delta-network of the capacity scaling solver).
+void dijkstra_potentials(const flat_graph& fg, const int* pot,
+                         int* dist, int* pred_arc, d_heap& heap,
+                         int min_res = 1);
+
+#endif
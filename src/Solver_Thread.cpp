@@ -0,0 +1,71 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Solver im Hintergrund-Thread mit Fortschrittsanzeige
+ *
+ * ************************/
+
+#include "Solver_Thread.h"
+#include "Graph_Prune.h"
+#include "Mcf_Stats.h"
+
+void solver_thread::start(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+                          const edge_map<int>& Gcap, bool cycle_canceling,
+                          bool record){
+    if (running.load()) return;
+    if (worker.joinable()) worker.join();
+
+    // Snapshot on the caller's thread; from here on the worker only
+    // touches the flat arrays. The solve runs on the pruned copy, which
+    // drops everything that cannot carry flow between the current
+    // supplies and demands.
+    fg_full.build(G,Gcost,Gcap);
+    prune_flat_graph(fg_full,fg);
+    running.store(true);
+    done.store(false);
+
+    worker = std::thread([this,cycle_canceling,record](){
+        std::vector<int> excess(fg.balance);
+        std::vector<int> pot(fg.n,0);
+        frame_recorder* rec = record ? &recorder : NULL;
+        if (rec != NULL) rec->start(fg);
+
+        mcf_result r = { false, 0, 0 };
+#ifdef MCF_STATS
+        g_mcf_stats.reset();
+#endif
+        // Cycle canceling routes its feasible flow cost-blind, so the
+        // cancellation loop afterwards does the actual optimizing; with
+        // the real costs in step 1 it would have nothing left to cancel
+        std::vector<int> real_cost;
+        if (cycle_canceling){
+            real_cost = fg.cost;
+            for(int a = 0; a < fg.m; a++) fg.cost[a] = 0;
+        }
+        r.flow_value = mcf_ssp_core(fg,excess,pot,r.feasible,NULL,&progress,rec);
+        if (cycle_canceling){
+            fg.cost = real_cost;
+            if (r.feasible)
+                mcf_cancel_negative_cycles(fg,NULL,&progress,rec);
+        }
+        r.total_cost = mcf_flat_cost(fg);
+
+        result = r;
+#ifdef MCF_STATS
+        g_mcf_stats.dump_json(stderr);
+#endif
+        progress.push(mcf_progress::PHASE_DONE,0,r.flow_value);
+        done.store(true);
+        running.store(false);
+    });
+}
+
+void solver_thread::sync_flow(const edge_map<int>& Gcap, edge_map<int>& Gflow){
+    if (worker.joinable()) worker.join();
+    // The untouched full snapshot writes 0 everywhere first, so edges
+    // the pruning removed do not keep a stale flow from an earlier run
+    fg_full.sync_flow(Gcap,Gflow);
+    fg.sync_flow(Gcap,Gflow);
+}
@@ -0,0 +1,54 @@
+/**************************
+ *	Studien_Projekt
+ *
+ *      Das Minimum Cost Flow Problem
+ *
+ *      Solver im Hintergrund-Thread mit Fortschrittsanzeige
+ *
+ * ************************/
+
+#ifndef SOLVER_THREAD_H
+#define SOLVER_THREAD_H
+
+#include "Frame_Recorder.h"
+#include "Min_Cost_Flow.h"
+
+#include <atomic>
+#include <thread>
+
+// Runs a solve on a background thread so the GraphWin edit loop stays
+// interactive. The snapshot is built on the caller's thread (LEDA
+// structures are not thread safe), the solve runs against the flat
+// arrays only, and the UI drains the mcf_progress ring at its own pace.
+// When finished() reports true, sync_flow() writes the result back —
+// again on the caller's thread.
+struct solver_thread {
+    flat_graph fg;        // pruned snapshot the solve runs on
+    flat_graph fg_full;   // unpruned snapshot, zeroes pruned edges on sync
+    mcf_progress progress;
+    mcf_result result;
+    frame_recorder recorder;   // filled when start() is asked to record
+
+    std::thread worker;
+    std::atomic<bool> running;
+    std::atomic<bool> done;
+
+    solver_thread() : result{false,0,0}, running(false), done(false) {}
+    ~solver_thread(){ if (worker.joinable()) worker.join(); }
+
+    // Snapshot G and start solving in the background; ignored while a
+    // solve is already running. cycle_canceling selects the algorithm.
+    // With record the recorder captures one frame per iteration for
+    // later replay; the solve still runs at full speed either way.
+    void start(GRAPH<int,int>& G, const edge_map<int>& Gcost,
+               const edge_map<int>& Gcap, bool cycle_canceling,
+               bool record = false);
+
+    bool is_running() const { return running.load(); }
+    bool finished() const { return done.load(); }
+
+    // After finished(): join the worker and write the flow back
+    void sync_flow(const edge_map<int>& Gcap, edge_map<int>& Gflow);
+};
+
+#endif
@@ -7,101 +7,8 @@
  *
  * ************************/
 
-#include <LEDA/graph/graph.h>
-#include <LEDA/graphics/graphwin.h>
+#include "Graph_Model.h"
 
-using namespace leda;
-
-// Variables
-const color cost_c = red;
-const color cap_c = blue;
-
-static GRAPH<int,int> G;
-
-static edge_map<int> Gcost(G);
-static edge_map<int> Gcap(G);
-
-// Initialize Edge Handler
-void init_edge(GraphWin& gw, edge e){
-    Gcap[e] = rand_int(10,20);
-    Gcost[e] = rand_int(30,50);
-    gw.set_width(e,Gcap[e]/10+5);
-    gw.set_slider_value(e,Gcap[e]/100.0,0);
-    gw.set_slider_value(e,Gcost[e]/100.0,1);
-    gw.set_label(e,string("cost = %d \n cap = %d",Gcost[e],Gcap[e]));
+int main(int argc, char* argv[]){
+    return run_editor<ALG_SSP>("Successive Shortest Path Algorithm",argc,argv);
 }
-
-void new_edge_handler(GraphWin& gw, edge e){
-    init_edge(gw,e);
-}
-
-// Initialize Node Handler
-void init_node(GraphWin& gw, node n){
-    gw.set_label_type(n, gw_label_type::data_label);
-}
-
-void new_node_handler(GraphWin& gw, node n){
-    init_node(gw, n);
-}
-
-// Cost Handler & Slider
-void cost_slider_handler(GraphWin& gw, edge e, double f){
-    Gcost[e] = int(100*f);
-    gw.set_label(e,string("cost = %d \n cap = %d",Gcost[e],Gcap[e]));
-}
-
-// Cap Handler & Slider
-void cap_slider_handler(GraphWin& gw,edge e, double f){
-    Gcap[e] = int(100*f);
-    gw.set_width(e,Gcap[e]/10+5);
-    gw.set_label(e,string("cost = %d \n cap = %d",Gcost[e],Gcap[e]));
-}
-
-int main(){
-    node v;
-
-    // Creating Graph Window
-    GraphWin gw(G,"Successive Shortest Path Algorithm");
-    gw.display(window::center, window::center);
-    gw.set_directed(true);
-
-    // Setting Handlers
-    gw.set_new_edge_handler(new_edge_handler);
-    gw.set_new_node_handler(new_node_handler);
-
-    gw.set_edge_slider_handler(cost_slider_handler,1);
-    gw.set_edge_slider_color(cost_c,1);
-
-    gw.set_edge_slider_handler(cap_slider_handler,0);
-    gw.set_edge_slider_color(cap_c,0);
-
-    while(gw.edit()){
-        int balance = 0;
-        forall_nodes(v,G) {
-            if (G.node_data()[v] > 0) {
-                gw.set_color(v, green);
-            }
-            else if (G.node_data()[v] < 0) {
-                gw.set_color(v, red);
-            }
-            else {
-                gw.set_color(v, grey1);
-            }
-        }
-
-        forall_nodes(v,G) {
-            balance += G.node_data()[v];
-        }
-      
-        if (balance != 0) {
-            gw.message("Supply/Demand values don't sum up to zero.");
-        }
-        else {
-            gw.message("Correct Supply Values.");
-        }
-    }
-
-    return 0;
-}
-
-